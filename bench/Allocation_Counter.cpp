@@ -0,0 +1,78 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Bench_s3d.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+static std::atomic<std::size_t> _Nof_allocations{0};
+
+
+auto s3d::bench::Allocation_Counter::count() noexcept-> std::size_t
+{
+	return _Nof_allocations.load(std::memory_order_relaxed);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+
+//	Eigen allocates through std::malloc rather than operator new, so the malloc family itself is
+//	interposed and forwarded to the glibc implementation .
+extern "C"
+{
+	void* __libc_malloc(std::size_t);
+	void* __libc_calloc(std::size_t, std::size_t);
+	void* __libc_realloc(void*, std::size_t);
+	void __libc_free(void*);
+
+
+	void* malloc(std::size_t size)
+	{
+		_Nof_allocations.fetch_add(1, std::memory_order_relaxed);
+
+		return __libc_malloc(size);
+	}
+
+
+	void* calloc(std::size_t n, std::size_t size)
+	{
+		_Nof_allocations.fetch_add(1, std::memory_order_relaxed);
+
+		return __libc_calloc(n, size);
+	}
+
+
+	void* realloc(void* p, std::size_t size)
+	{
+		_Nof_allocations.fetch_add(1, std::memory_order_relaxed);
+
+		return __libc_realloc(p, size);
+	}
+
+
+	void free(void* p){  __libc_free(p);  }
+}
+
+#else
+
+auto operator new(std::size_t size)-> void*
+{
+	_Nof_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if(void* const p = std::malloc(size == 0 ? 1 : size);  p != nullptr)
+		return p;
+	else
+		throw std::bad_alloc{};
+}
+
+
+void operator delete(void* p) noexcept{  std::free(p);  }
+void operator delete(void* p, std::size_t) noexcept{  std::free(p);  }
+
+#endif
@@ -0,0 +1,138 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Bench_s3d.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+
+static auto _json_string(std::string const& s)-> std::string
+{
+	std::string res = "\"";
+
+	for(char const c : s)
+		if(c == '"' || c == '\\')
+			res += '\\',  res += c;
+		else
+			res += c;
+
+	return res += '"';
+}
+
+
+void s3d::bench::Suite::print_table(std::ostream& os) const
+{
+	os	<< std::left
+		<< std::setw(72) << "benchmark" << std::setw(8) << "scalar"
+		<< std::setw(10) << "shape" << std::setw(9) << "sizing"
+		<< std::right
+		<< std::setw(14) << "ns/op" << std::setw(16) << "ops/sec" << std::setw(12) << "allocs/op"
+		<< '\n';
+
+	for(auto const& r : _records)
+		os	<< std::left
+			<< std::setw(72) << r.module + "::" + r.name << std::setw(8) << r.scalar
+			<< std::setw(10) << r.shape << std::setw(9) << r.sizing
+			<< std::right << std::fixed
+			<< std::setw(14) << std::setprecision(2) << r.ns_per_op
+			<< std::setw(16) << std::setprecision(0) << r.ops_per_sec
+			<< std::setw(12) << std::setprecision(2) << r.allocs_per_op
+			<< '\n';
+}
+
+
+void s3d::bench::Suite::write_json(std::ostream& os) const
+{
+	os << "{\n\t\"benchmarks\": [";
+
+	for(std::size_t i = 0;  i < _records.size();  ++i)
+	{
+		auto const& r = _records[i];
+
+		os	<< (i == 0 ? "\n" : ",\n")
+			<< "\t\t{"
+			<< "\"module\": " << _json_string(r.module)
+			<< ", \"name\": " << _json_string(r.name)
+			<< ", \"scalar\": " << _json_string(r.scalar)
+			<< ", \"shape\": " << _json_string(r.shape)
+			<< ", \"sizing\": " << _json_string(r.sizing)
+			<< ", \"iterations\": " << r.iterations
+			<< std::setprecision(17)
+			<< ", \"ns_per_op\": " << r.ns_per_op
+			<< ", \"ops_per_sec\": " << r.ops_per_sec
+			<< ", \"allocs_per_op\": " << r.allocs_per_op
+			<< "}";
+	}
+
+	os << "\n\t]\n}\n";
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void _print_usage(char const* const exe)
+{
+	std::cout
+	<<	"usage: " << exe << " [--json <file>|-] [--filter <substring>] [--min-time <ms>]\n"
+	<<	"  --json      writes results as JSON to <file>, or to stdout for '-'\n"
+	<<	"  --filter    runs only benchmarks whose \"Module::name\" contains <substring>\n"
+	<<	"  --min-time  minimum measuring time per benchmark in milliseconds (default 100)\n";
+}
+
+
+int main(int const argc, char const* const argv[])
+{
+	char const* json_path = nullptr;
+	std::string filter;
+	double min_time_ms = 100;
+
+	for(int i = 1;  i < argc;  ++i)
+		if( std::strcmp(argv[i], "--json") == 0 && i + 1 < argc )
+			json_path = argv[++i];
+		else if( std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc )
+			filter = argv[++i];
+		else if( std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc )
+			min_time_ms = std::atof(argv[++i]);
+		else
+			return _print_usage(argv[0]),  (int)1;
+
+	s3d::bench::Suite suite(filter, min_time_ms);
+
+	s3d::bench::Bench_Hamilton(suite);
+	s3d::bench::Bench_Quaternion(suite);
+	s3d::bench::Bench_Affine(suite);
+	s3d::bench::Bench_Euclid(suite);
+	s3d::bench::Bench_Decomposition(suite);
+	s3d::bench::Bench_PointSet(suite);
+	s3d::bench::Bench_Sparse(suite);
+	s3d::bench::Bench_DualQuaternion(suite);
+	s3d::bench::Bench_BVH(suite);
+	s3d::bench::Bench_KdTree(suite);
+	s3d::bench::Bench_Registration(suite);
+	s3d::bench::Bench_RANSAC(suite);
+
+	if( json_path != nullptr && std::strcmp(json_path, "-") == 0 )
+		suite.write_json(std::cout);
+	else
+	{
+		suite.print_table(std::cout);
+
+		if(json_path != nullptr)
+		{
+			std::ofstream ofs(json_path);
+
+			if(!ofs)
+				return std::cerr << "cannot open " << json_path << '\n',  (int)1;
+
+			suite.write_json(ofs);
+		}
+	}
+
+	return (int)0;
+}
@@ -0,0 +1,216 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#include "S3D/Hamilton/Hamilton.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//	C++17 or higher version of language support is required.
+
+
+namespace s3d::bench
+{
+
+	struct Record;
+
+	class Suite;
+
+
+	/**	Number of heap allocations made by this process so far .
+	*	On glibc every malloc family call is counted ( Eigen allocates through std::malloc ) ,
+	*	otherwise only global operator new is counted .
+	*/
+	struct Allocation_Counter{  static auto count() noexcept-> std::size_t;  };
+
+
+	template<class T>
+	static void Keep(T const& t) noexcept;
+
+	template<class T>
+	static auto constexpr Scalar_Name() noexcept-> char const*;
+
+	template<class T>
+	static auto Random(T const low = T(-1), T const high = T(1))-> T;
+
+	template<class MAT>
+	static auto Random_Mat(std::size_t const rows, std::size_t const cols)-> MAT;
+
+	template<std::size_t SIZE>
+	static auto constexpr Sizing_Name() noexcept-> char const*;
+
+
+	void Bench_Hamilton(Suite& suite);
+	void Bench_Quaternion(Suite& suite);
+	void Bench_Affine(Suite& suite);
+	void Bench_Euclid(Suite& suite);
+	void Bench_Decomposition(Suite& suite);
+	void Bench_PointSet(Suite& suite);
+	void Bench_Sparse(Suite& suite);
+	void Bench_DualQuaternion(Suite& suite);
+	void Bench_BVH(Suite& suite);
+	void Bench_KdTree(Suite& suite);
+	void Bench_Registration(Suite& suite);
+	void Bench_RANSAC(Suite& suite);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+struct s3d::bench::Record
+{
+	std::string module, name, scalar, shape, sizing;
+	std::size_t iterations;
+	double ns_per_op, ops_per_sec, allocs_per_op;
+};
+
+
+class s3d::bench::Suite
+{
+public:
+	Suite(std::string filter = "", double const min_time_ms = 100)
+	:	_filter(filter), _min_time_ms(min_time_ms){}
+
+
+	/**	Runs f repeatedly until min_time_ms is spent and records the best of 3 passes .
+	*	nof_items normalizes a call of f processing a whole batch into per-item figures .
+	*/
+	template<class F>
+	void measure
+	(	char const* module, char const* name, char const* scalar
+	,	char const* shape, char const* sizing, F&& f, std::size_t const nof_items = 1
+	);
+
+
+	auto records() const-> std::vector<Record> const&{  return _records;  }
+
+	void print_table(std::ostream& os) const;
+	void write_json(std::ostream& os) const;
+
+
+private:
+	std::string _filter;
+	double _min_time_ms;
+	std::vector<Record> _records;
+
+
+	template<class F>
+	static auto _elapsed_ns(F& f, std::size_t const n)-> double
+	{
+		auto const t0 = std::chrono::steady_clock::now();
+
+		for(std::size_t i = 0;  i < n;  ++i)
+			f();
+
+		auto const t1 = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::nano>(t1 - t0).count();
+	}
+};
+
+
+template<class F>
+void s3d::bench::Suite::measure
+(	char const* module, char const* name, char const* scalar
+,	char const* shape, char const* sizing, F&& f, std::size_t const nof_items
+)
+{
+	std::string const full_name = std::string(module) + "::" + name;
+
+	if( !_filter.empty() && full_name.find(_filter) == std::string::npos )
+		return;
+
+	f();	// warm up .
+
+	double const target_ns = _min_time_ms * 1e6;
+	std::size_t n = 1;
+
+	for(double ns = _elapsed_ns(f, n);  ns < target_ns/10;  ns = _elapsed_ns(f, n))
+		n *= ns < target_ns/1000 ? 10 : 2;
+
+	n = static_cast<std::size_t>( n * target_ns / std::max(_elapsed_ns(f, n), 1.0) / 3 ) + 1;
+
+	double best_ns = _elapsed_ns(f, n);
+
+	for(int pass = 1;  pass < 3;  ++pass)
+		best_ns = std::min( best_ns, _elapsed_ns(f, n) );
+
+	std::size_t const nof_allocs = Allocation_Counter::count();
+
+	_elapsed_ns(f, n);
+
+	std::size_t const allocs = Allocation_Counter::count() - nof_allocs;
+	double const nof_ops = static_cast<double>(n) * static_cast<double>(nof_items);
+
+	_records.push_back
+	(	Record
+		{	module, name, scalar, shape, sizing, n
+		,	best_ns / nof_ops, nof_ops / best_ns * 1e9, static_cast<double>(allocs) / nof_ops
+		}
+	);
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+template<class T>
+void s3d::bench::Keep(T const& t) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r"(&t) : "memory");
+#else
+	static void const* volatile sink = nullptr;
+
+	sink = &t;
+#endif
+}
+
+
+template<class T>
+auto constexpr s3d::bench::Scalar_Name() noexcept-> char const*
+{
+	if constexpr(std::is_same<T, float>::value)
+		return "float";
+	else if constexpr(std::is_same<T, double>::value)
+		return "double";
+	else
+		return "other";
+}
+
+
+template<class T>
+auto s3d::bench::Random(T const low, T const high)-> T
+{
+	static std::mt19937 engine(20201231);
+
+	return std::uniform_real_distribution<T>(low, high)(engine);
+}
+
+
+template<class MAT>
+auto s3d::bench::Random_Mat(std::size_t const rows, std::size_t const cols)-> MAT
+{
+	MAT res(rows, cols);
+
+	for(std::size_t i = 0;  i < rows;  ++i)
+		for(std::size_t j = 0;  j < cols;  ++j)
+			res(i, j) = Random< trait::value_t<MAT> >();
+
+	return res;
+}
+
+
+template<std::size_t SIZE>
+auto constexpr s3d::bench::Sizing_Name() noexcept-> char const*
+{
+	return SIZE == DYNAMIC ? "DYNAMIC" : "fixed";
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
@@ -0,0 +1,212 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/Affine/Affine.hpp"
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+using s3d::bench::Random_Mat;
+
+
+template<class T>
+static void Rotation_Operations(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	Vec_t const v = Random_Mat<Vec_t>(3, 1);
+	s3d::UnitVec<T, 3> const axis = Random_Mat<Vec_t>(3, 1);
+	T const angle = Random<T>(0, 3);
+
+	s3d::Rotation<T, 3> const rot1(axis, angle),  rot2(axis, -angle/2);
+
+	suite.measure
+	(	"Affine", "Rotation<T,3>::Rotation (spin)", scalar, "3", "fixed"
+	,	[&]{  Keep(axis),  Keep(angle);  s3d::Rotation<T, 3> const r(axis, angle);  Keep(r);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rotation<T,3>::operator()", scalar, "3", "fixed"
+	,	[&]{  Keep(rot1),  Keep(v);  Vec_t const w = rot1(v);  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rotation<T,3>::cortho_mat", scalar, "3x3", "fixed"
+	,	[&]{  Keep(rot1);  s3d::OrthogonalMat<T, 3> const R = rot1.cortho_mat();  Keep(R);  }
+	);
+
+	s3d::Cached_Rotation<T> const cached = rot1;
+
+	suite.measure
+	(	"Affine", "Cached_Rotation<T>::operator()", scalar, "3", "fixed"
+	,	[&]{  Keep(cached),  Keep(v);  Vec_t const w = cached(v);  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rotation<T,3>::unit_qtn (assign)", scalar, "3", "fixed"
+	,	[&, r = rot1]() mutable
+		{  
+			Keep(rot2);  r.unit_qtn() = rot2.cunit_qtn();  Keep(r);  
+		}
+	);
+
+	suite.measure
+	(	"Affine", "Rotation<T,3>::rotate", scalar, "3", "fixed"
+	,	[&]{  Keep(rot1),  Keep(rot2);  s3d::Rotation<T, 3> const r = rot1.rotate(rot2);  Keep(r);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rotation<T,2>::operator()", scalar, "2", "fixed"
+	,	[&, rot = s3d::Rotation<T, 2>(angle), u = Random_Mat< s3d::Vector<T, 2> >(2, 1)]
+		{
+			Keep(rot),  Keep(u);  s3d::Vector<T, 2> const w = rot(u);  Keep(w);
+		}
+	);
+}
+
+
+template<class T>
+static void Transform_Operations(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+	using Mat_t = s3d::Matrix<T, 3, 3>;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	Vec_t const v = Random_Mat<Vec_t>(3, 1),  t = Random_Mat<Vec_t>(3, 1);
+	s3d::UnitVec<T, 3> const axis = Random_Mat<Vec_t>(3, 1);
+
+	s3d::Rigid_Body_Transform<T, 3> const 
+		rbtr1 = s3d::Afn<T, 3>.rotate(axis, T(.5)).translate(t),
+		rbtr2 = s3d::Afn<T, 3>.rotate(axis, T(-1)).translate(v);
+
+	s3d::Scalable_Body_Transform<T, 3> const sbtr = rbtr1.scale( T(2) );
+	s3d::Affine_Transform<T, 3> const atr( Random_Mat<Mat_t>(3, 3), t );
+
+	suite.measure
+	(	"Affine", "Affine_Transform::_transfer", scalar, "3", "fixed"
+	,	[&]{  Keep(atr),  Keep(v);  Vec_t const w = v >> atr;  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Affine", "Scalable_Body_Transform::_transfer", scalar, "3", "fixed"
+	,	[&]{  Keep(sbtr),  Keep(v);  Vec_t const w = v >> sbtr;  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rigid_Body_Transform::_transfer", scalar, "3", "fixed"
+	,	[&]{  Keep(rbtr1),  Keep(v);  Vec_t const w = v >> rbtr1;  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Affine", "Affine_Transform::_compose", scalar, "3", "fixed"
+	,	[&]{  Keep(atr),  Keep(rbtr1);  s3d::Affine_Transform<T, 3> const a = atr >> rbtr1;  Keep(a);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rigid_Body_Transform::_compose", scalar, "3", "fixed"
+	,	[&]
+		{
+			Keep(rbtr1),  Keep(rbtr2);  
+			
+			s3d::Rigid_Body_Transform<T, 3> const r = rbtr1 >> rbtr2;  
+			
+			Keep(r);  
+		}
+	);
+
+	suite.measure
+	(	"Affine", "Affine_Transform::_inv", scalar, "3", "fixed"
+	,	[&]{  Keep(atr);  s3d::Affine_Transform<T, 3> const a = atr.inv();  Keep(a);  }
+	);
+
+	suite.measure
+	(	"Affine", "Rigid_Body_Transform::_inv", scalar, "3", "fixed"
+	,	[&]{  Keep(rbtr1);  s3d::Rigid_Body_Transform<T, 3> const r = rbtr1.inv();  Keep(r);  }
+	);
+}
+
+
+template<class T>
+static void Batch_Transfer(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	std::size_t constexpr nof_points = 1024;
+
+	std::vector<Vec_t> points;
+
+	for(std::size_t i = 0;  i < nof_points;  ++i)
+		points.push_back( Random_Mat<Vec_t>(3, 1) );
+
+	//	A rigid body transform keeps repeatedly transferred points bounded .
+	s3d::Rigid_Body_Transform<T, 3> const rbtr 
+	=	s3d::Afn<T, 3>.rotate( s3d::UnitVec<T, 3>{1, 2, 3}, T(.1) );
+
+	suite.measure
+	(	"Affine", "operator>>= (iterable, per point)", s3d::bench::Scalar_Name<T>(), "1024x3", "fixed"
+	,	[&]{  points >>= rbtr;  Keep(points);  }
+	,	nof_points
+	);
+
+	s3d::PointSet<T, 3> ps = points;
+
+	suite.measure
+	(	"Affine", "operator>>= (PointSet, per point)", s3d::bench::Scalar_Name<T>(), "1024x3", "fixed"
+	,	[&]{  ps >>= rbtr;  Keep(ps);  }
+	,	nof_points
+	);
+}
+
+
+template<class T>
+static void Parallel_Transfer(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	std::size_t constexpr nof_points = 1 << 20;
+
+	std::vector<Vec_t> points(nof_points, Random_Mat<Vec_t>(3, 1));
+	s3d::PointSet<T, 3> ps = points;
+
+	s3d::Rigid_Body_Transform<T, 3> const rbtr 
+	=	s3d::Afn<T, 3>.rotate( s3d::UnitVec<T, 3>{1, 2, 3}, T(.1) );
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	suite.measure
+	(	"Affine", "transform_all PAR (iterable, per point)", scalar, "1Mx3", "fixed"
+	,	[&]{  s3d::transform_all(s3d::PAR, points, rbtr);  Keep(points);  }
+	,	nof_points
+	);
+
+	suite.measure
+	(	"Affine", "transform_all PAR (PointSet, per point)", scalar, "1Mx3", "fixed"
+	,	[&]{  s3d::transform_all(s3d::PAR, ps, rbtr);  Keep(ps);  }
+	,	nof_points
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Affine(Suite& suite)
+{
+	::Rotation_Operations<float>(suite);
+	::Rotation_Operations<double>(suite);
+
+	::Transform_Operations<float>(suite);
+	::Transform_Operations<double>(suite);
+
+	::Batch_Transfer<float>(suite);
+	::Batch_Transfer<double>(suite);
+
+	::Parallel_Transfer<float>(suite);
+	::Parallel_Transfer<double>(suite);
+}
@@ -0,0 +1,118 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/BVH/BVH.hpp"
+#include <limits>
+#include <string>
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+using s3d::bench::Random_Mat;
+
+
+template<class T, class PRIM>
+static auto Random_Primitive()-> PRIM
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	Vec_t const x = T(100)*Random_Mat<Vec_t>(3, 1);
+
+	if constexpr(s3d::trait::is_StrictVec<PRIM>::value)
+		return x;
+	else
+		return PRIM( x, s3d::UnitVec<T, 3>( Random_Mat<Vec_t>(3, 1) ) );
+}
+
+
+template<class T, class PRIM>
+static void Nearest_Queries(s3d::bench::Suite& suite, char const* const tag)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	std::size_t constexpr nof_prims = 100000, nof_queries = 256;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	std::vector<PRIM> prims;
+	std::vector<Vec_t> queries;
+
+	for(std::size_t i = 0;  i < nof_prims;  ++i)
+		prims.push_back( ::Random_Primitive<T, PRIM>() );
+
+	for(std::size_t i = 0;  i < nof_queries;  ++i)
+		queries.push_back( T(100)*Random_Mat<Vec_t>(3, 1) );
+
+	std::string const prim_name = std::string(" (") + tag + ", per query)";
+
+	suite.measure
+	(	"BVH", ( std::string("linear scan nearest") + prim_name ).c_str(), scalar, "100k", "fixed"
+	,	[&]
+		{
+			for(auto const& q : queries)
+			{
+				std::size_t res = 0;
+				T min_sqr_dist = std::numeric_limits<T>::infinity();
+
+				for(std::size_t i = 0;  i < prims.size();  ++i)
+					if( T const d = s3d::sqrDistance(q, prims[i]);  d < min_sqr_dist )
+						min_sqr_dist = d,  res = i;
+
+				Keep(res);
+			}
+		}
+	,	nof_queries
+	);
+
+	suite.measure
+	(	"BVH", ( std::string("BVH build") + prim_name.substr(0, prim_name.find(',')) + ")" ).c_str()
+	,	scalar, "100k", "fixed"
+	,	[&]{  s3d::BVH const bvh(prims);  Keep(bvh);  }
+	);
+
+	s3d::BVH const bvh(prims);
+
+	suite.measure
+	(	"BVH", ( std::string("BVH::nearest") + prim_name ).c_str(), scalar, "100k", "fixed"
+	,	[&]
+		{
+			for(auto const& q : queries)
+			{
+				auto const res = bvh.nearest(q);
+
+				Keep(res);
+			}
+		}
+	,	nof_queries
+	);
+
+	suite.measure
+	(	"BVH", ( std::string("BVH::nearest k=8") + prim_name ).c_str(), scalar, "100k", "fixed"
+	,	[&]
+		{
+			for(auto const& q : queries)
+			{
+				auto const res = bvh.nearest(q, 8);
+
+				Keep(res);
+			}
+		}
+	,	nof_queries
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_BVH(Suite& suite)
+{
+	::Nearest_Queries< float, s3d::Vector<float, 3> >(suite, "points");
+	::Nearest_Queries< float, s3d::Plane<float, 3> >(suite, "Planes");
+	::Nearest_Queries< float, s3d::Line<float, 3> >(suite, "Lines");
+
+	::Nearest_Queries< double, s3d::Plane<double, 3> >(suite, "Planes");
+}
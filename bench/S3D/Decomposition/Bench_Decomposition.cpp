@@ -0,0 +1,408 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/Decomposition/Decomposition.hpp"
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+using s3d::bench::Random_Mat;
+
+
+template<class T, std::size_t N>
+static void Eigen_Decompositions(s3d::bench::Suite& suite)
+{
+	using Mat_t = s3d::Matrix<T, N, N>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<N>();
+
+	Mat_t const A = Random_Mat<Mat_t>(3, 3),  S = A + A.transpose();
+
+	sgm::Flag_Set<s3d::flag::Real_Symmetric> constexpr real_symmetric{};
+
+	suite.measure
+	(	"Decomposition", "Eigen_Decomposition::operator() (Real_Symmetric)", scalar, "3x3", sizing
+	,	[&, ed = s3d::Eigen_Decomposition(S, real_symmetric)]() mutable
+		{
+			Keep(S);  ed(S, real_symmetric);  Keep(ed);
+		}
+	);
+
+	suite.measure
+	(	"Decomposition", "Eigen_Decomposition::operator() (general)", scalar, "3x3", sizing
+	,	[&, ed = s3d::Eigen_Decomposition(A)]() mutable{  Keep(A);  ed(A);  Keep(ed);  }
+	);
+}
+
+
+template<class T>
+static void Symmetric_Eigen_Batches(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr nof_mats = 10'000;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::PointSet<T, 6> covs(nof_mats);
+
+	for(std::size_t idx = 0;  idx < nof_mats;  ++idx)
+	{
+		auto const A = Random_Mat< s3d::Matrix<T, 3, 3> >(3, 3);
+		s3d::Matrix<T, 3, 3> const C = A*A.transpose();
+
+		covs.set(idx, s3d::Vector<T, 6>{C(0, 0), C(0, 1), C(0, 2), C(1, 1), C(1, 2), C(2, 2)});
+	}
+
+	suite.measure
+	(	"Decomposition", "Symmetric_Eigen_Batch::operator() (SEQ, 10k)", scalar, "3x3", "fixed"
+	,	[&, batch = s3d::Symmetric_Eigen_Batch<T, 3>()]() mutable
+		{
+			Keep(covs);  batch(s3d::SEQ, covs);  Keep(batch);
+		}
+	,	nof_mats
+	);
+
+	suite.measure
+	(	"Decomposition", "Symmetric_Eigen_Batch::operator() (PAR, 10k)", scalar, "3x3", "fixed"
+	,	[&, batch = s3d::Symmetric_Eigen_Batch<T, 3>()]() mutable
+		{
+			Keep(covs);  batch(s3d::PAR, covs);  Keep(batch);
+		}
+	,	nof_mats
+	);
+
+	suite.measure
+	(	"Decomposition", "Eigen_Decomposition loop (Real_Symmetric, 10k)", scalar, "3x3", "fixed"
+	,	[&, ed = s3d::Eigen_Decomposition< T, 3, 3, s3d::Storing_Order::COL_FIRST, true >
+			(	s3d::Matrix<T, 3, 3>::identity(), sgm::Flag_Set<s3d::flag::Real_Symmetric>{}
+			)
+		]() mutable
+		{
+			Keep(covs);
+
+			for(std::size_t idx = 0;  idx < nof_mats;  ++idx)
+			{
+				auto const c = covs.point(idx);
+
+				ed
+				(	s3d::Matrix<T, 3, 3>
+					{	c(0), c(1), c(2)
+					,	c(1), c(3), c(4)
+					,	c(2), c(4), c(5)
+					}
+				);
+
+				Keep(ed);
+			}
+		}
+	,	nof_mats
+	);
+}
+
+
+template<class T, std::size_t R, std::size_t C>
+static void Singular_Value_Decompositions
+(	s3d::bench::Suite& suite, char const* const shape, std::size_t const rows, std::size_t const cols
+)
+{
+	using Mat_t = s3d::Matrix<T, R, C>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<R>();
+
+	Mat_t const A = Random_Mat<Mat_t>(rows, cols);
+
+	suite.measure
+	(	"Decomposition", "Singular_Value_Decomposition::operator() (ThinMat)", scalar, shape, sizing
+	,	[&, svd = s3d::Singular_Value_Decomposition(A)]() mutable{  Keep(A);  svd(A);  Keep(svd);  }
+	);
+
+	sgm::Flag_Set<s3d::flag::Value_Only> constexpr value_only{};
+
+	suite.measure
+	(	"Decomposition", "Singular_Value_Decomposition::operator() (Value_Only)", scalar, shape, sizing
+	,	[&, svd = s3d::Singular_Value_Decomposition(A, value_only)]() mutable
+		{
+			Keep(A);  svd(A, value_only);  Keep(svd);
+		}
+	);
+
+	auto const truncated = sgm::Flags( s3d::flag::RelativelyTrunc<T>( T(.5) ) );
+
+	//	as a per-frame low rank approximation , with the temporaries it reads .
+	suite.measure
+	(	"Decomposition", "Singular_Value_Decomposition truncated U*D*V^T", scalar, shape, sizing
+	,	[&, svd = s3d::Singular_Value_Decomposition(A, truncated)]() mutable
+		{
+			Keep(A);  svd(A, truncated);
+
+			Mat_t const B = svd.Umat()*svd.diagmat()*svd.Vmat().transpose();
+
+			Keep(B);
+		}
+	);
+}
+
+
+template<class T>
+static void Singular_Value_Batches(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr nof_mats = 10'000;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::PointSet<T, 9> mats(nof_mats);
+
+	for(std::size_t idx = 0;  idx < nof_mats;  ++idx)
+		mats.set( idx, Random_Mat< s3d::Vector<T, 9> >(9, 1) );
+
+	suite.measure
+	(	"Decomposition", "Singular_Value_Batch::operator() (SEQ, 10k)", scalar, "3x3", "fixed"
+	,	[&, batch = s3d::Singular_Value_Batch<T, 3>()]() mutable
+		{
+			Keep(mats);  batch(s3d::SEQ, mats);  Keep(batch);
+		}
+	,	nof_mats
+	);
+
+	suite.measure
+	(	"Decomposition", "Singular_Value_Batch::operator() (PAR, 10k)", scalar, "3x3", "fixed"
+	,	[&, batch = s3d::Singular_Value_Batch<T, 3>()]() mutable
+		{
+			Keep(mats);  batch(s3d::PAR, mats);  Keep(batch);
+		}
+	,	nof_mats
+	);
+}
+
+
+template<class T, std::size_t R, std::size_t C>
+static void Least_Square_Problems
+(	s3d::bench::Suite& suite, char const* const shape, std::size_t const rows, std::size_t const cols
+)
+{
+	using Mat_t = s3d::Matrix<T, R, C>;
+	using Vec_t = s3d::Vector<T, R>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<R>();
+
+	Mat_t const A = Random_Mat<Mat_t>(rows, cols);
+	Vec_t const b = Random_Mat<Vec_t>(rows, 1);
+
+	suite.measure
+	(	"Decomposition", "Least_Square_Problem::solution<QR>", scalar, shape, sizing
+	,	[&]
+		{
+			Keep(A),  Keep(b);
+
+			auto const x = s3d::Least_Square_Problem::solution<s3d::Solving_Mode::QR>(A, b);
+
+			Keep(x);
+		}
+	);
+
+	suite.measure
+	(	"Decomposition", "Least_Square_Problem::solution<SVD>", scalar, shape, sizing
+	,	[&]
+		{
+			Keep(A),  Keep(b);
+
+			auto const x = s3d::Least_Square_Problem::solution<s3d::Solving_Mode::SVD>(A, b);
+
+			Keep(x);
+		}
+	);
+
+	suite.measure
+	(	"Decomposition", "Least_Square_Problem::solution<CHOLESKY>", scalar, shape, sizing
+	,	[&]
+		{
+			Keep(A),  Keep(b);
+
+			auto const x = s3d::Least_Square_Problem::solution<s3d::Solving_Mode::CHOLESKY>(A, b);
+
+			Keep(x);
+		}
+	);
+}
+
+
+template<class T, std::size_t R, std::size_t C, s3d::Solving_Mode SM>
+static void Least_Square_Solvers
+(	s3d::bench::Suite& suite, char const* const mode, std::size_t const rows, std::size_t const cols
+)
+{
+	using Mat_t = s3d::Matrix<T, R, C>;
+	using Vec_t = s3d::Vector<T, R>;
+
+	std::size_t constexpr nof_rhs = 100;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<R>();
+
+	Mat_t const A = Random_Mat<Mat_t>(rows, cols);
+	s3d::Matrix<T, R, s3d::DYNAMIC> const B = Random_Mat< s3d::Matrix<T, R, s3d::DYNAMIC> >(rows, nof_rhs);
+
+	std::string const tag = std::string("<") + mode + "> x100 rhs";
+
+	suite.measure
+	(	"Decomposition", ( std::string("Least_Square_Problem::solution") + tag ).c_str(), scalar, "20x3", sizing
+	,	[&]
+		{
+			Keep(A),  Keep(B);
+
+			for(std::size_t j = 0;  j < nof_rhs;  ++j)
+			{
+				Vec_t const b = B.col(j);
+				auto const x = s3d::Least_Square_Problem::solution<SM>(A, b);
+
+				Keep(x);
+			}
+		}
+	,	nof_rhs
+	);
+
+	suite.measure
+	(	"Decomposition", ( std::string("Least_Square_Solver::solve(b)") + tag ).c_str(), scalar, "20x3", sizing
+	,	[&]
+		{
+			Keep(A),  Keep(B);
+
+			auto const solver = s3d::Least_Square_Problem::solver<SM>(A);
+
+			for(std::size_t j = 0;  j < nof_rhs;  ++j)
+			{
+				Vec_t const b = B.col(j);
+				auto const x = solver.solve(b);
+
+				Keep(x);
+			}
+		}
+	,	nof_rhs
+	);
+
+	suite.measure
+	(	"Decomposition", ( std::string("Least_Square_Solver::solve(B)") + tag ).c_str(), scalar, "20x3", sizing
+	,	[&]
+		{
+			Keep(A),  Keep(B);
+
+			auto const X = s3d::Least_Square_Problem::solver<SM>(A).solve(B);
+
+			Keep(X);
+		}
+	,	nof_rhs
+	);
+}
+
+
+template<class T, s3d::Solving_Mode SM, class FS>
+static void Iterative_Least_Square_Solvers(s3d::bench::Suite& suite, char const* const name, FS fs)
+{
+	using Entry = typename s3d::SparseMat<T>::Entry;
+
+	std::size_t constexpr rows = 20'000, cols = 2'000;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	std::vector<Entry> entries;
+
+	//	every row touches its own column and three random ones with widely ranging scales
+	for(std::size_t i = 0;  i < rows;  ++i)
+	{
+		entries.push_back( Entry{i, i % cols, T(4)} );
+
+		for(int k = 0;  k < 3;  ++k)
+			entries.push_back
+			(	Entry
+				{	i, static_cast<std::size_t>( Random<T>(0, T(cols - 1)) )
+				,	Random<T>()*std::pow( T(10), Random<T>(-1, 1) )
+				}
+			);
+	}
+
+	s3d::SparseMat<T> const A(rows, cols, entries);
+	s3d::Vector<T> const b = Random_Mat< s3d::Vector<T> >(rows, 1);
+
+	suite.measure
+	(	"Decomposition", name, scalar, "20kx2k", "DYNAMIC"
+	,	[&]
+		{
+			Keep(A),  Keep(b);
+
+			auto const x = s3d::Least_Square_Problem::solution<SM>(A, b, fs);
+
+			Keep(x);
+		}
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Decomposition(Suite& suite)
+{
+	::Eigen_Decompositions<float, 3>(suite);
+	::Eigen_Decompositions<float, DYNAMIC>(suite);
+	::Eigen_Decompositions<double, 3>(suite);
+	::Eigen_Decompositions<double, DYNAMIC>(suite);
+
+	::Symmetric_Eigen_Batches<float>(suite);
+	::Symmetric_Eigen_Batches<double>(suite);
+
+	::Singular_Value_Decompositions<float, 3, 3>(suite, "3x3", 3, 3);
+	::Singular_Value_Decompositions<float, DYNAMIC, DYNAMIC>(suite, "3x3", 3, 3);
+	::Singular_Value_Decompositions<double, 3, 3>(suite, "3x3", 3, 3);
+	::Singular_Value_Decompositions<double, DYNAMIC, DYNAMIC>(suite, "3x3", 3, 3);
+	::Singular_Value_Decompositions<float, 20, 3>(suite, "20x3", 20, 3);
+	::Singular_Value_Decompositions<float, DYNAMIC, DYNAMIC>(suite, "20x3", 20, 3);
+	::Singular_Value_Decompositions<double, 20, 3>(suite, "20x3", 20, 3);
+	::Singular_Value_Decompositions<double, DYNAMIC, DYNAMIC>(suite, "20x3", 20, 3);
+
+	::Singular_Value_Batches<float>(suite);
+	::Singular_Value_Batches<double>(suite);
+
+	::Least_Square_Problems<float, 20, 3>(suite, "20x3", 20, 3);
+	::Least_Square_Problems<float, DYNAMIC, DYNAMIC>(suite, "20x3", 20, 3);
+	::Least_Square_Problems<double, 20, 3>(suite, "20x3", 20, 3);
+	::Least_Square_Problems<double, DYNAMIC, DYNAMIC>(suite, "20x3", 20, 3);
+
+	::Least_Square_Solvers<float, 20, 3, s3d::Solving_Mode::QR>(suite, "QR", 20, 3);
+	::Least_Square_Solvers<float, 20, 3, s3d::Solving_Mode::SVD>(suite, "SVD", 20, 3);
+	::Least_Square_Solvers<float, 20, 3, s3d::Solving_Mode::CHOLESKY>(suite, "CHOLESKY", 20, 3);
+	::Least_Square_Solvers<float, DYNAMIC, DYNAMIC, s3d::Solving_Mode::QR>(suite, "QR", 20, 3);
+
+	{
+		using s3d::Solving_Mode;
+		namespace flag = s3d::flag;
+
+		::Iterative_Least_Square_Solvers<double, Solving_Mode::LSQR>
+		(	suite, "Least_Square_Problem::solution<LSQR>", sgm::Flags( flag::Tolerance<double>(1e-8) )
+		);
+
+		::Iterative_Least_Square_Solvers<double, Solving_Mode::LSQR>
+		(	suite, "Least_Square_Problem::solution<LSQR> (Preconditioned)"
+		,	sgm::Flags( flag::Tolerance<double>(1e-8), flag::Preconditioned{} )
+		);
+
+		::Iterative_Least_Square_Solvers<double, Solving_Mode::CG>
+		(	suite, "Least_Square_Problem::solution<CG>", sgm::Flags( flag::Tolerance<double>(1e-8) )
+		);
+
+		::Iterative_Least_Square_Solvers<double, Solving_Mode::CG>
+		(	suite, "Least_Square_Problem::solution<CG> (Preconditioned)"
+		,	sgm::Flags( flag::Tolerance<double>(1e-8), flag::Preconditioned{} )
+		);
+	}
+}
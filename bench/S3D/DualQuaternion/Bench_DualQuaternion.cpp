@@ -0,0 +1,203 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/DualQuaternion/DualQuaternion.hpp"
+#include <array>
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+using s3d::bench::Random_Mat;
+
+
+template<class T>
+static auto Random_Rigid_Body_Transform()-> s3d::Rigid_Body_Transform<T, 3>
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	return
+	s3d::Afn<T, 3>
+	.	rotate( s3d::UnitVec<T, 3>( Random_Mat<Vec_t>(3, 1) ), Random<T>(-3, 3) )
+	.	translate( Random_Mat<Vec_t>(3, 1) );
+}
+
+
+template<class T>
+static void Single_Operations(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+	using UDQ_t = s3d::UnitDualQuaternion<T>;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::Rigid_Body_Transform<T, 3> const
+		rbtr1 = ::Random_Rigid_Body_Transform<T>(),  rbtr2 = ::Random_Rigid_Body_Transform<T>();
+
+	UDQ_t const udq1 = rbtr1,  udq2 = rbtr2;
+	Vec_t const v = Random_Mat<Vec_t>(3, 1);
+	T const t = Random<T>(0, 1);
+
+	suite.measure
+	(	"DualQuaternion", "UnitDualQuaternion::operator*", scalar, "8", "fixed"
+	,	[&]{  Keep(udq1),  Keep(udq2);  UDQ_t const udq = udq2*udq1;  Keep(udq);  }
+	);
+
+	suite.measure
+	(	"DualQuaternion", "UnitDualQuaternion::operator()", scalar, "8", "fixed"
+	,	[&]{  Keep(udq1),  Keep(v);  Vec_t const w = udq1(v);  Keep(w);  }
+	);
+
+	suite.measure
+	(	"DualQuaternion", "UnitDualQuaternion::ScLERP", scalar, "8", "fixed"
+	,	[&]{  Keep(udq1),  Keep(udq2);  UDQ_t const udq = UDQ_t::ScLERP(udq1, udq2, t);  Keep(udq);  }
+	);
+
+	suite.measure
+	(	"DualQuaternion", "UnitDualQuaternion(Rigid_Body_Transform)", scalar, "8", "fixed"
+	,	[&]{  Keep(rbtr1);  UDQ_t const udq = rbtr1;  Keep(udq);  }
+	);
+
+	suite.measure
+	(	"DualQuaternion", "UnitDualQuaternion::rigid_body_transform", scalar, "8", "fixed"
+	,	[&]
+		{
+			Keep(udq1);
+
+			s3d::Rigid_Body_Transform<T, 3> const r = udq1.rigid_body_transform();
+
+			Keep(r);
+		}
+	);
+}
+
+
+template<class T>
+static void Chain_Composition(s3d::bench::Suite& suite)
+{
+	using UDQ_t = s3d::UnitDualQuaternion<T>;
+
+	std::size_t constexpr nof_links = 1000;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	std::vector< s3d::Rigid_Body_Transform<T, 3> > rbtrs;
+	std::vector<UDQ_t> udqs;
+
+	for(std::size_t i = 0;  i < nof_links;  ++i)
+		rbtrs.push_back( ::Random_Rigid_Body_Transform<T>() ),  udqs.push_back(rbtrs.back());
+
+	suite.measure
+	(	"DualQuaternion", "chain of Rigid_Body_Transform (per link)", scalar, "1000", "fixed"
+	,	[&]
+		{
+			s3d::Rigid_Body_Transform<T, 3> r;
+
+			for(auto const& q : rbtrs)
+				r = r >> q;
+
+			Keep(r);
+		}
+	,	nof_links
+	);
+
+	suite.measure
+	(	"DualQuaternion", "chain of UnitDualQuaternion (per link)", scalar, "1000", "fixed"
+	,	[&]
+		{
+			UDQ_t r;
+
+			for(auto const& q : udqs)
+				r = q*r;
+
+			Keep(r);
+		}
+	,	nof_links
+	);
+}
+
+
+template<class T>
+static void Batch_Kernels(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	std::size_t constexpr nof_bones = 64, nof_verts = 1 << 16, K = 4;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::PointSet<T, 8> bones, lhs, rhs;
+
+	for(std::size_t i = 0;  i < nof_bones;  ++i)
+		bones.push_back(  s3d::UnitDualQuaternion<T>( ::Random_Rigid_Body_Transform<T>() ).lanes()  );
+
+	for(std::size_t i = 0;  i < nof_verts;  ++i)
+	{
+		lhs.push_back(  s3d::UnitDualQuaternion<T>( ::Random_Rigid_Body_Transform<T>() ).lanes()  );
+		rhs.push_back(  s3d::UnitDualQuaternion<T>( ::Random_Rigid_Body_Transform<T>() ).lanes()  );
+	}
+
+	std::vector< std::array<std::size_t, K> > indices(nof_verts);
+	s3d::PointSet<T, K> weights(nof_verts);
+	s3d::PointSet<T, 3> points(nof_verts);
+
+	for(std::size_t i = 0;  i < nof_verts;  ++i)
+	{
+		T sum = 0;
+
+		for(std::size_t j = 0;  j < K;  ++j)
+		{
+			indices[i][j] = static_cast<std::size_t>( Random<T>(0, T(nof_bones - 1)) );
+			sum += weights(i, j) = Random<T>(0, 1);
+		}
+
+		for(std::size_t j = 0;  j < K;  ++j)
+			weights(i, j) /= sum;
+
+		points.set( i, Random_Mat<Vec_t>(3, 1) );
+	}
+
+	suite.measure
+	(	"DualQuaternion", "compose_all SEQ (per pair)", scalar, "64kx8", "fixed"
+	,	[&]{  auto const res = s3d::compose_all(s3d::SEQ, lhs, rhs);  Keep(res);  }
+	,	nof_verts
+	);
+
+	suite.measure
+	(	"DualQuaternion", "blend_all SEQ (4 influences, per vertex)", scalar, "64kx8", "fixed"
+	,	[&]{  auto const res = s3d::blend_all(s3d::SEQ, bones, indices, weights);  Keep(res);  }
+	,	nof_verts
+	);
+
+	suite.measure
+	(	"DualQuaternion", "blend_all PAR (4 influences, per vertex)", scalar, "64kx8", "fixed"
+	,	[&]{  auto const res = s3d::blend_all(s3d::PAR, bones, indices, weights);  Keep(res);  }
+	,	nof_verts
+	);
+
+	auto const blended = s3d::blend_all(s3d::SEQ, bones, indices, weights);
+
+	suite.measure
+	(	"DualQuaternion", "transform_all SEQ (per point)", scalar, "64kx3", "fixed"
+	,	[&]{  s3d::transform_all(s3d::SEQ, points, blended);  Keep(points);  }
+	,	nof_verts
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_DualQuaternion(Suite& suite)
+{
+	::Single_Operations<float>(suite);
+	::Single_Operations<double>(suite);
+
+	::Chain_Composition<float>(suite);
+	::Chain_Composition<double>(suite);
+
+	::Batch_Kernels<float>(suite);
+	::Batch_Kernels<double>(suite);
+}
@@ -0,0 +1,218 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/Euclid/Euclid.hpp"
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random_Mat;
+
+
+template<class T>
+static void Euclid_Operations(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	Vec_t const
+		p = Random_Mat<Vec_t>(3, 1),  q = Random_Mat<Vec_t>(3, 1),
+		x = Random_Mat<Vec_t>(3, 1),  n = Random_Mat<Vec_t>(3, 1);
+
+	s3d::Plane<T, 3> const plane( x, s3d::UnitVec<T, 3>(n) );
+	s3d::Line<T, 3> const line( x, s3d::UnitVec<T, 3>(q) );
+
+	suite.measure
+	(	"Euclid", "Distance (point, point)", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(q);  T const d = s3d::Distance(p, q);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Euclid", "sqrDistance (point, point)", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(q);  T const d = s3d::sqrDistance(p, q);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Euclid", "Distance (point, Plane)", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(plane);  T const d = s3d::Distance(p, plane);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Euclid", "Distance (point, Line)", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(line);  T const d = s3d::Distance(p, line);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Euclid", "Plane::signed_dist_to", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(plane);  T const d = plane.signed_dist_to(p);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Euclid", "Projection (point, Plane)", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(plane);  Vec_t const r = s3d::Projection(p, plane);  Keep(r);  }
+	);
+
+	suite.measure
+	(	"Euclid", "Projection (point, Line)", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(line);  Vec_t const r = s3d::Projection(p, line);  Keep(r);  }
+	);
+
+	suite.measure
+	(	"Euclid", "intersection (Line, Plane)", scalar, "3", "fixed"
+	,	[&]{  Keep(line),  Keep(plane);  auto const r = s3d::intersection(line, plane);  Keep(r);  }
+	);
+
+	suite.measure
+	(	"Euclid", "Direction::angle", scalar, "3", "fixed"
+	,	[&]{  Keep(p),  Keep(q);  auto const r = s3d::Direction::angle(p, q);  Keep(r);  }
+	);
+}
+
+
+//	The batch kernels against calling the per point functions in a loop over the same points .
+template<class T>
+static void Batch_Operations(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	std::size_t constexpr n = 1 << 16;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::PointSet<T, 3> points(n),  res(n);
+	std::vector<T> dists(n);
+
+	for(std::size_t i = 0;  i < n;  ++i)
+		points.set( i, Random_Mat<Vec_t>(3, 1) );
+
+	s3d::Plane<T, 3> const plane( Random_Mat<Vec_t>(3, 1), s3d::UnitVec<T, 3>(Random_Mat<Vec_t>(3, 1)) );
+	s3d::Line<T, 3> const line( Random_Mat<Vec_t>(3, 1), s3d::UnitVec<T, 3>(Random_Mat<Vec_t>(3, 1)) );
+
+	suite.measure
+	(	"Euclid", "Plane::signed_dist_to loop (per point)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			for(std::size_t i = 0;  i < n;  ++i)
+				dists[i] = plane.signed_dist_to( points(i) );
+
+			Keep(dists);
+		}
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "signed_dist_all (per point)", scalar, "64kx3", "fixed"
+	,	[&]{  s3d::signed_dist_all(s3d::SEQ, points, plane, dists);  Keep(dists);  }
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "sqrDistance (point, Line) loop (per point)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			for(std::size_t i = 0;  i < n;  ++i)
+				dists[i] = s3d::sqrDistance( points(i), line );
+
+			Keep(dists);
+		}
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "sqrDistance_all (Line) (per point)", scalar, "64kx3", "fixed"
+	,	[&]{  s3d::sqrDistance_all(s3d::SEQ, points, line, dists);  Keep(dists);  }
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "Projection (point, Plane) loop (per point)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			for(std::size_t i = 0;  i < n;  ++i)
+				res.set(  i, Vec_t( s3d::Projection(points(i), plane) )  );
+
+			Keep(res);
+		}
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "Projection_all (Plane) (per point)", scalar, "64kx3", "fixed"
+	,	[&]{  s3d::Projection_all(s3d::SEQ, points, plane, res);  Keep(res);  }
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "Projection_all (Line) (per point)", scalar, "64kx3", "fixed"
+	,	[&]{  s3d::Projection_all(s3d::SEQ, points, line, res);  Keep(res);  }
+	,	n
+	);
+}
+
+
+template<class T>
+static void Ray_Casting(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	std::size_t constexpr n = 1 << 16;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	std::vector< s3d::Triangle<T, 3> > triangles;
+	std::vector<T> dists(n);
+
+	triangles.reserve(n);
+
+	for(std::size_t i = 0;  i < n;  ++i)
+		triangles.emplace_back
+		(	Random_Mat<Vec_t>(3, 1), Random_Mat<Vec_t>(3, 1), Random_Mat<Vec_t>(3, 1)
+		);
+
+	s3d::Ray<T, 3> const ray( Random_Mat<Vec_t>(3, 1), s3d::UnitVec<T, 3>(Random_Mat<Vec_t>(3, 1)) );
+
+	suite.measure
+	(	"Euclid", "intersection (Ray, Triangle) loop (per triangle)", scalar, "64k", "fixed"
+	,	[&]
+		{
+			std::size_t nof_hits = 0;
+
+			for(std::size_t i = 0;  i < n;  ++i)
+				nof_hits += s3d::intersection(ray, triangles[i]).has_value();
+
+			Keep(nof_hits);
+		}
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "ray_cast_all (Triangle) SEQ (per triangle)", scalar, "64k", "fixed"
+	,	[&]{  s3d::ray_cast_all(s3d::SEQ, ray, triangles, dists);  Keep(dists);  }
+	,	n
+	);
+
+	suite.measure
+	(	"Euclid", "ray_cast_all (Triangle) PAR (per triangle)", scalar, "64k", "fixed"
+	,	[&]{  s3d::ray_cast_all(s3d::PAR, ray, triangles, dists);  Keep(dists);  }
+	,	n
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Euclid(Suite& suite)
+{
+	::Euclid_Operations<float>(suite);
+	::Euclid_Operations<double>(suite);
+
+	::Batch_Operations<float>(suite);
+	::Batch_Operations<double>(suite);
+
+	::Ray_Casting<float>(suite);
+	::Ray_Casting<double>(suite);
+}
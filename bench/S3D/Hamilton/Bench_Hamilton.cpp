@@ -0,0 +1,342 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random_Mat;
+
+
+template<class T, std::size_t N>
+static void Matrix_Operations(s3d::bench::Suite& suite)
+{
+	using Mat_t = s3d::Matrix<T, N, N>;
+	using Vec_t = s3d::Vector<T, N>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<N>();
+
+	Mat_t const A = Random_Mat<Mat_t>(3, 3) + T(3)*Mat_t::identity(3),  B = Random_Mat<Mat_t>(3, 3);
+	Vec_t const u = Random_Mat<Vec_t>(3, 1),  v = Random_Mat<Vec_t>(3, 1);
+
+	suite.measure
+	(	"Hamilton", "Matrix::operator*", scalar, "3x3", sizing
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A*B;  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::operator* (vector)", scalar, "3x3", sizing
+	,	[&]{  Keep(A),  Keep(u);  Vec_t const w = A*u;  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::operator+", scalar, "3x3", sizing
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A + B;  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::transpose", scalar, "3x3", sizing
+	,	[&]{  Keep(A);  Mat_t const C = A.transpose();  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::inv", scalar, "3x3", sizing
+	,	[&]{  Keep(A);  Mat_t const C = A.inv();  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::det", scalar, "3x3", sizing
+	,	[&]{  Keep(A);  T const d = A.det();  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::dot", scalar, "3", sizing
+	,	[&]{  Keep(u),  Keep(v);  T const d = u.dot(v);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::normalized", scalar, "3", sizing
+	,	[&]{  Keep(u);  Vec_t const w = u.normalized();  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::dyadic", scalar, "3", sizing
+	,	[&]{  Keep(u),  Keep(v);  Mat_t const C = u.dyadic(v);  Keep(C);  }
+	);
+
+	//	Eigen defines cross product only for vectors of static size 3 .
+	if constexpr(N != s3d::DYNAMIC)
+	{
+		suite.measure
+		(	"Hamilton", "Matrix::cross", scalar, "3", sizing
+		,	[&]{  Keep(u),  Keep(v);  Vec_t const w = u.cross(v);  Keep(w);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "Matrix::skew", scalar, "3", sizing
+		,	[&]{  Keep(u);  s3d::Matrix<T, 3, 3> const C = u.skew();  Keep(C);  }
+		);
+	}
+}
+
+
+template<class T, std::size_t N>
+static void Matrix_Operations_Large(s3d::bench::Suite& suite)
+{
+	using Mat_t = s3d::Matrix<T, N, N>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<N>();
+
+	Mat_t const A = Random_Mat<Mat_t>(16, 16),  B = Random_Mat<Mat_t>(16, 16);
+
+	suite.measure
+	(	"Hamilton", "Matrix::operator*", scalar, "16x16", sizing
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A*B;  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "Matrix::operator+", scalar, "16x16", sizing
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A + B;  Keep(C);  }
+	);
+}
+
+
+/**	The kernels that Matrix operations of static sizes up to 4x4 take with S3D_FIXED_SIZE_KERNELS ,
+*	called directly so that they are measured next to Matrix_Operations in the same build .
+*/
+template<class T, std::size_t N>
+static void Fixed_Size_Kernels(s3d::bench::Suite& suite)
+{
+	using Mat_t = s3d::Matrix<T, N, N>;
+	using Vec_t = s3d::Vector<T, N>;
+	using Kernel = s3d::_Fixed_Kernel_Helper<T>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const shape = N == 3 ? "3x3" : "4x4";
+
+	Mat_t const A = Random_Mat<Mat_t>(N, N) + T(3)*Mat_t::identity(),  B = Random_Mat<Mat_t>(N, N);
+	Vec_t const u = Random_Mat<Vec_t>(N, 1),  v = Random_Mat<Vec_t>(N, 1);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel operator*", scalar, shape, "fixed"
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = Kernel::mul(A, B);  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel operator* (vector)", scalar, shape, "fixed"
+	,	[&]{  Keep(A),  Keep(u);  Vec_t const w = Kernel::mul(A, u);  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel operator+", scalar, shape, "fixed"
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = Kernel::add(A, B);  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel transpose", scalar, shape, "fixed"
+	,	[&]{  Keep(A);  Mat_t const C = Kernel::transpose(A);  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel inv", scalar, shape, "fixed"
+	,	[&]{  Keep(A);  Mat_t const C = Kernel::inv(A);  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel det", scalar, shape, "fixed"
+	,	[&]{  Keep(A);  T const d = Kernel::det(A);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel dot", scalar, N == 3 ? "3" : "4", "fixed"
+	,	[&]{  Keep(u),  Keep(v);  T const d = Kernel::dot(u, v);  Keep(d);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "unrolled kernel dyadic", scalar, N == 3 ? "3" : "4", "fixed"
+	,	[&]{  Keep(u),  Keep(v);  Mat_t const C = Kernel::dyadic(u, v);  Keep(C);  }
+	);
+
+	if constexpr(N == 3)
+	{
+		suite.measure
+		(	"Hamilton", "unrolled kernel cross", scalar, "3", "fixed"
+		,	[&]{  Keep(u),  Keep(v);  Vec_t const w = Kernel::cross(u, v);  Keep(w);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "unrolled kernel skew", scalar, "3", "fixed"
+		,	[&]{  Keep(u);  s3d::Matrix<T, 3, 3> const C = Kernel::skew(u);  Keep(C);  }
+		);
+	}
+	else
+	{
+		suite.measure
+		(	"Hamilton", "Matrix::operator*", scalar, "4x4", "fixed"
+		,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A*B;  Keep(C);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "Matrix::operator* (vector)", scalar, "4x4", "fixed"
+		,	[&]{  Keep(A),  Keep(u);  Vec_t const w = A*u;  Keep(w);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "Matrix::operator+", scalar, "4x4", "fixed"
+		,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A + B;  Keep(C);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "Matrix::transpose", scalar, "4x4", "fixed"
+		,	[&]{  Keep(A);  Mat_t const C = A.transpose();  Keep(C);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "Matrix::det", scalar, "4x4", "fixed"
+		,	[&]{  Keep(A);  T const d = A.det();  Keep(d);  }
+		);
+
+		suite.measure
+		(	"Hamilton", "Matrix::inv", scalar, "4x4", "fixed"
+		,	[&]{  Keep(A);  Mat_t const C = A.inv();  Keep(C);  }
+		);
+	}
+}
+
+
+/**	Composite expressions against the same arithmetic written as one hand-fused loop .
+*	Both should be alike when the whole expression is kept lazy through to the assignment .
+*/
+template<class T, std::size_t N>
+static void Expression_Fusion(s3d::bench::Suite& suite)
+{
+	using Mat_t = s3d::Matrix<T, N, N>;
+	using Vec_t = s3d::Vector<T, N>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<N>();
+
+	Mat_t const A = Random_Mat<Mat_t>(3, 3),  B = Random_Mat<Mat_t>(3, 3),  I = Mat_t::identity(3);
+	Vec_t const v = Random_Mat<Vec_t>(3, 1);
+	T const w = T(.5);
+
+	//	rotation matrix of quaternion ( w , v ) .
+	suite.measure
+	(	"Hamilton", "fused (w*w - |v|^2)*I + 2w*[v]x + 2v*v^T", scalar, "3x3", sizing
+	,	[&]
+		{
+			Keep(v);
+			Mat_t const C = (w*w - v.sqr_norm())*I + T(2)*w*v.skew() + T(2)*v.dyadic(v);
+			Keep(C);
+		}
+	);
+
+	suite.measure
+	(	"Hamilton", "hand-fused (w*w - |v|^2)*I + 2w*[v]x + 2v*v^T", scalar, "3x3", sizing
+	,	[&]
+		{
+			Keep(v);
+
+			T const x = v(0), y = v(1), z = v(2), s = w*w - (x*x + y*y + z*z);
+			Mat_t C(3, 3);
+
+			C(0, 0) = s + 2*x*x,  C(0, 1) = 2*(x*y - w*z),  C(0, 2) = 2*(x*z + w*y),
+			C(1, 0) = 2*(x*y + w*z),  C(1, 1) = s + 2*y*y,  C(1, 2) = 2*(y*z - w*x),
+			C(2, 0) = 2*(x*z - w*y),  C(2, 1) = 2*(y*z + w*x),  C(2, 2) = s + 2*z*z;
+
+			Keep(C);
+		}
+	);
+
+	suite.measure
+	(	"Hamilton", "fused A*B + B*A - 2A", scalar, "3x3", sizing
+	,	[&]{  Keep(A),  Keep(B);  Mat_t const C = A*B + B*A - T(2)*A;  Keep(C);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "hand-fused A*B + B*A - 2A", scalar, "3x3", sizing
+	,	[&]
+		{
+			Keep(A),  Keep(B);
+
+			Mat_t C(3, 3);
+
+			for(std::size_t i = 0;  i < 3;  ++i)
+				for(std::size_t j = 0;  j < 3;  ++j)
+				{
+					T c = -2*A(i, j);
+
+					for(std::size_t k = 0;  k < 3;  ++k)
+						c += A(i, k)*B(k, j) + B(i, k)*A(k, j);
+
+					C(i, j) = c;
+				}
+
+			Keep(C);
+		}
+	);
+}
+
+
+template<class T, std::size_t N>
+static void Normalized_Types(s3d::bench::Suite& suite)
+{
+	using Mat_t = s3d::Matrix<T, N, N>;
+	using Vec_t = s3d::Vector<T, N>;
+
+	char const
+		*const scalar = s3d::bench::Scalar_Name<T>(),
+		*const sizing = s3d::bench::Sizing_Name<N>();
+
+	Mat_t const A = Random_Mat<Mat_t>(3, 3) + T(3)*Mat_t::identity(3);
+	Vec_t const u = Random_Mat<Vec_t>(3, 1);
+
+	suite.measure
+	(	"Hamilton", "UnitVec::UnitVec", scalar, "3", sizing
+	,	[&]{  Keep(u);  s3d::UnitVec<T, N> const w = u;  Keep(w);  }
+	);
+
+	suite.measure
+	(	"Hamilton", "OrthogonalMat::OrthogonalMat", scalar, "3x3", sizing
+	,	[&]{  Keep(A);  s3d::OrthogonalMat<T, N> const R = A;  Keep(R);  }
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Hamilton(Suite& suite)
+{
+	::Matrix_Operations<float, 3>(suite);
+	::Matrix_Operations<float, DYNAMIC>(suite);
+	::Matrix_Operations<double, 3>(suite);
+	::Matrix_Operations<double, DYNAMIC>(suite);
+
+	::Matrix_Operations_Large<float, 16>(suite);
+	::Matrix_Operations_Large<float, DYNAMIC>(suite);
+	::Matrix_Operations_Large<double, 16>(suite);
+	::Matrix_Operations_Large<double, DYNAMIC>(suite);
+
+	::Fixed_Size_Kernels<float, 3>(suite);
+	::Fixed_Size_Kernels<float, 4>(suite);
+	::Fixed_Size_Kernels<double, 3>(suite);
+	::Fixed_Size_Kernels<double, 4>(suite);
+
+	::Expression_Fusion<float, 3>(suite);
+	::Expression_Fusion<float, DYNAMIC>(suite);
+	::Expression_Fusion<double, 3>(suite);
+	::Expression_Fusion<double, DYNAMIC>(suite);
+
+	::Normalized_Types<float, 3>(suite);
+	::Normalized_Types<float, DYNAMIC>(suite);
+	::Normalized_Types<double, 3>(suite);
+	::Normalized_Types<double, DYNAMIC>(suite);
+}
@@ -0,0 +1,91 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/KdTree/KdTree.hpp"
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+
+
+template<class T, std::size_t DIM>
+static auto Random_Points(std::size_t const n)-> s3d::PointSet<T, DIM>
+{
+	s3d::PointSet<T, DIM> res(n);
+
+	for(std::size_t i = 0;  i < n;  ++i)
+		for(std::size_t d = 0;  d < DIM;  ++d)
+			res(i, d) = Random<T>(-100, 100);
+
+	return res;
+}
+
+
+template<class T>
+static void Build_and_Queries(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr nof_points = 1 << 18, nof_queries = 1 << 16, k = 8;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	auto const points = ::Random_Points<T, 3>(nof_points);
+	auto const queries = ::Random_Points<T, 3>(nof_queries);
+
+	suite.measure
+	(	"KdTree", "KdTree SEQ build (per point)", scalar, "256kx3", "fixed"
+	,	[&]{  s3d::KdTree<T, 3> const tree(s3d::SEQ, points);  Keep(tree);  }
+	,	nof_points
+	);
+
+	suite.measure
+	(	"KdTree", "KdTree PAR build (per point)", scalar, "256kx3", "fixed"
+	,	[&]{  s3d::KdTree<T, 3> const tree(s3d::PAR, points);  Keep(tree);  }
+	,	nof_points
+	);
+
+	s3d::KdTree<T, 3> const tree(s3d::PAR, points);
+
+	suite.measure
+	(	"KdTree", "KdTree::nearest loop (per query)", scalar, "256kx3", "fixed"
+	,	[&]
+		{
+			for(std::size_t i = 0;  i < nof_queries;  ++i)
+			{
+				auto const res = tree.nearest( queries(i) );
+
+				Keep(res);
+			}
+		}
+	,	nof_queries
+	);
+
+	suite.measure
+	(	"KdTree", "nearest_all SEQ k=8 (per query)", scalar, "256kx3", "fixed"
+	,	[&]{  auto const res = s3d::nearest_all(s3d::SEQ, tree, queries, k);  Keep(res);  }
+	,	nof_queries
+	);
+
+	suite.measure
+	(	"KdTree", "nearest_all PAR k=8 (per query)", scalar, "256kx3", "fixed"
+	,	[&]{  auto const res = s3d::nearest_all(s3d::PAR, tree, queries, k);  Keep(res);  }
+	,	nof_queries
+	);
+
+	suite.measure
+	(	"KdTree", "within_all PAR r=2 (per query)", scalar, "256kx3", "fixed"
+	,	[&]{  auto const res = s3d::within_all(s3d::PAR, tree, queries, T(2));  Keep(res);  }
+	,	nof_queries
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_KdTree(Suite& suite)
+{
+	::Build_and_Queries<float>(suite);
+	::Build_and_Queries<double>(suite);
+}
@@ -0,0 +1,55 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random_Mat;
+
+
+template<class T>
+static void PointSet_Operations(s3d::bench::Suite& suite)
+{
+	using Vec_t = s3d::Vector<T, 3>;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+	std::size_t constexpr nof_points = 4096;
+
+	s3d::PointSet<T, 3> ps;
+
+	for(std::size_t i = 0;  i < nof_points;  ++i)
+		ps.push_back( Random_Mat<Vec_t>(3, 1) );
+
+	suite.measure
+	(	"PointSet", "PointSet::point (per point)", scalar, "4096x3", "fixed"
+	,	[&]
+		{
+			for(std::size_t i = 0;  i < nof_points;  ++i)
+			{
+				Vec_t const p = ps(i);
+
+				Keep(p);
+			}
+		}
+	,	nof_points
+	);
+
+	suite.measure
+	(	"PointSet", "PointSet::lane dot (per point)", scalar, "4096x3", "fixed"
+	,	[&]{  Keep(ps);  T const d = ps.lane(0).dot(ps.lane(1));  Keep(d);  }
+	,	nof_points
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_PointSet(Suite& suite)
+{
+	::PointSet_Operations<float>(suite);
+	::PointSet_Operations<double>(suite);
+}
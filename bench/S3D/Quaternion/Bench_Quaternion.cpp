@@ -0,0 +1,189 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/Quaternion/Quaternion.hpp"
+#include <string>
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+
+
+template<class T>
+static void Quaternion_Operations(s3d::bench::Suite& suite)
+{
+	using Qtn_t = s3d::Quaternion<T>;
+	using UQtn_t = s3d::UnitQuaternion<T>;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	Qtn_t const
+		q1( Random<T>(), Random<T>(), Random<T>(), Random<T>() ),
+		q2( Random<T>(), Random<T>(), Random<T>(), Random<T>() );
+
+	UQtn_t const uq1 = q1,  uq2 = q2;
+	T const t = Random<T>(0, 1);
+
+	suite.measure
+	(	"Quaternion", "Quaternion::operator*", scalar, "4", "fixed"
+	,	[&]{  Keep(q1),  Keep(q2);  Qtn_t const q = q1*q2;  Keep(q);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "Quaternion::operator+", scalar, "4", "fixed"
+	,	[&]{  Keep(q1),  Keep(q2);  Qtn_t const q = q1 + q2;  Keep(q);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "Quaternion::inv", scalar, "4", "fixed"
+	,	[&]{  Keep(q1);  Qtn_t const q = q1.inv();  Keep(q);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "Quaternion::normalized", scalar, "4", "fixed"
+	,	[&]{  Keep(q1);  Qtn_t const q = q1.normalized();  Keep(q);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "UnitQuaternion::UnitQuaternion", scalar, "4", "fixed"
+	,	[&]{  Keep(q1);  UQtn_t const uq = q1;  Keep(uq);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "UnitQuaternion::operator*", scalar, "4", "fixed"
+	,	[&]{  Keep(uq1),  Keep(uq2);  Qtn_t const q = uq1*uq2;  Keep(q);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "UnitQuaternion::inv", scalar, "4", "fixed"
+	,	[&]{  Keep(uq1);  UQtn_t const uq = uq1.inv();  Keep(uq);  }
+	);
+
+	suite.measure
+	(	"Quaternion", "UnitQuaternion::Slerp", scalar, "4", "fixed"
+	,	[&]{  Keep(uq1),  Keep(uq2);  UQtn_t const uq = UQtn_t::Slerp(uq1, uq2, t);  Keep(uq);  }
+	);
+}
+
+
+template<class T>
+static void Batch_Interpolation(s3d::bench::Suite& suite)
+{
+	using UQtn_t = s3d::UnitQuaternion<T>;
+
+	std::size_t constexpr nof_pairs = 1 << 20, nof_keys = 1 << 10;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	auto random_uqtn_f
+	=	[]{  return UQtn_t( Random<T>(), Random<T>(), Random<T>(), Random<T>() );  };
+
+	std::vector<UQtn_t> uq0s, uq1s;
+	std::vector<T> ts, params;
+	s3d::PointSet<T, 4> q0s, q1s, keys;
+
+	for(std::size_t i = 0;  i < nof_pairs;  ++i)
+	{
+		uq0s.push_back( random_uqtn_f() ),  uq1s.push_back( random_uqtn_f() );
+
+		q0s.push_back( s3d::Vector<T, 4>{uq0s[i].w(), uq0s[i].x(), uq0s[i].y(), uq0s[i].z()} );
+		q1s.push_back( s3d::Vector<T, 4>{uq1s[i].w(), uq1s[i].x(), uq1s[i].y(), uq1s[i].z()} );
+
+		ts.push_back( Random<T>(0, 1) ),  params.push_back( Random<T>(0, T(nof_keys - 1)) );
+	}
+
+	for(std::size_t i = 0;  i < nof_keys;  ++i)
+		keys.push_back( q0s(i) );
+
+	std::vector<UQtn_t> res(nof_pairs);
+
+	suite.measure
+	(	"Quaternion", "UnitQuaternion::Slerp loop (per pair)", scalar, "1Mx4", "fixed"
+	,	[&]
+		{
+			for(std::size_t i = 0;  i < nof_pairs;  ++i)
+				res[i] = UQtn_t::Slerp(uq0s[i], uq1s[i], ts[i]);
+
+			Keep(res);
+		}
+	,	nof_pairs
+	);
+
+	suite.measure
+	(	"Quaternion", "slerp_all SEQ (per pair)", scalar, "1Mx4", "fixed"
+	,	[&]{  auto const qs = s3d::slerp_all(s3d::SEQ, q0s, q1s, ts);  Keep(qs);  }
+	,	nof_pairs
+	);
+
+	suite.measure
+	(	"Quaternion", "slerp_all PAR (per pair)", scalar, "1Mx4", "fixed"
+	,	[&]{  auto const qs = s3d::slerp_all(s3d::PAR, q0s, q1s, ts);  Keep(qs);  }
+	,	nof_pairs
+	);
+
+	suite.measure
+	(	"Quaternion", "nlerp_all SEQ (per pair)", scalar, "1Mx4", "fixed"
+	,	[&]{  auto const qs = s3d::nlerp_all(s3d::SEQ, q0s, q1s, ts);  Keep(qs);  }
+	,	nof_pairs
+	);
+
+	suite.measure
+	(	"Quaternion", "squad_all SEQ (1k keys, per sample)", scalar, "1Mx4", "fixed"
+	,	[&]{  auto const qs = s3d::squad_all(s3d::SEQ, keys, params);  Keep(qs);  }
+	,	nof_pairs
+	);
+}
+
+
+template<class T, std::size_t BITS>
+static void Packing(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr nof_qtns = 1 << 20;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+	std::string const tag = BITS == 32 ? "<32>" : "<48>";
+
+	s3d::PointSet<T, 4> qs;
+
+	for(std::size_t i = 0;  i < nof_qtns;  ++i)
+	{
+		s3d::UnitQuaternion<T> const uq( Random<T>(), Random<T>(), Random<T>(), Random<T>() );
+
+		qs.push_back( s3d::Vector<T, 4>{uq.w(), uq.x(), uq.y(), uq.z()} );
+	}
+
+	auto const pqs = s3d::encode_all<BITS>(s3d::SEQ, qs);
+
+	suite.measure
+	(	"Quaternion", ( "encode_all" + tag + " SEQ (per quaternion)" ).c_str(), scalar, "1Mx4", "fixed"
+	,	[&]{  auto const res = s3d::encode_all<BITS>(s3d::SEQ, qs);  Keep(res);  }
+	,	nof_qtns
+	);
+
+	suite.measure
+	(	"Quaternion", ( "decode_all" + tag + " SEQ (per quaternion)" ).c_str(), scalar, "1Mx4", "fixed"
+	,	[&]{  auto const res = s3d::decode_all<T>(s3d::SEQ, pqs);  Keep(res);  }
+	,	nof_qtns
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Quaternion(Suite& suite)
+{
+	::Quaternion_Operations<float>(suite);
+	::Quaternion_Operations<double>(suite);
+
+	::Batch_Interpolation<float>(suite);
+	::Batch_Interpolation<double>(suite);
+
+	::Packing<float, 32>(suite);
+	::Packing<float, 48>(suite);
+	::Packing<double, 32>(suite);
+	::Packing<double, 48>(suite);
+}
@@ -0,0 +1,106 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/RANSAC/RANSAC.hpp"
+#include <cmath>
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+using s3d::bench::Random_Mat;
+
+
+//	Half of the points near the plane z = x/2 , the other half anywhere .
+template<class T>
+static auto Noisy_Plane(std::size_t const n)-> s3d::PointSet<T, 3>
+{
+	s3d::PointSet<T, 3> res(n);
+
+	for(std::size_t i = 0;  i < n;  ++i)
+	{
+		T const x = Random<T>(-10, 10),  y = Random<T>(-10, 10);
+
+		res(i, 0) = x,  res(i, 1) = y;
+		res(i, 2) = i % 2 == 0 ? x/2 + Random<T>(T(-.01), T(.01)) : Random<T>(-10, 10);
+	}
+
+	return res;
+}
+
+
+template<class T>
+static void Plane_Fitting(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr n = 1 << 16, nof_hypotheses = 64;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+	T const threshold = T(.05);
+
+	auto const points = ::Noisy_Plane<T>(n);
+
+	std::vector< s3d::Plane<T, 3> > hypotheses;
+
+	for(std::size_t h = 0;  h < nof_hypotheses;  ++h)
+		hypotheses.emplace_back
+		(	s3d::Vector<T, 3>::Zero(), s3d::UnitVec<T, 3>( Random_Mat< s3d::Vector<T, 3> >(3, 1) )
+		);
+
+	suite.measure
+	(	"RANSAC", "signed_dist_to loop score (per point hypothesis)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			for(auto const& plane : hypotheses)
+			{
+				std::size_t nof_inliers = 0;
+
+				for(std::size_t i = 0;  i < n;  ++i)
+					if( std::abs(plane.signed_dist_to( points(i) )) <= threshold )
+						++nof_inliers;
+
+				Keep(nof_inliers);
+			}
+		}
+	,	n*nof_hypotheses
+	);
+
+	suite.measure
+	(	"RANSAC", "lane kernel score (per point hypothesis)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			for(auto const& plane : hypotheses)
+				Keep( s3d::_Consensus_Kernel::score(points, plane, threshold*threshold) );
+		}
+	,	n*nof_hypotheses
+	);
+
+	//	a fixed number of hypotheses , as no confidence short of 1 is asked .
+	auto const flags
+	=	[]{  return sgm::Flags( s3d::flag::Confidence<T>(1), s3d::flag::Iteration_Cap(nof_hypotheses) );  };
+
+	s3d::Sample_Consensus< s3d::Plane<T, 3> > sac(threshold, flags());
+
+	suite.measure
+	(	"RANSAC", "Sample_Consensus SEQ fit (per point hypothesis)", scalar, "64kx3", "fixed"
+	,	[&]{  Keep( sac.fit(s3d::SEQ, points) );  }
+	,	n*nof_hypotheses
+	);
+
+	suite.measure
+	(	"RANSAC", "Sample_Consensus PAR fit (per point hypothesis)", scalar, "64kx3", "fixed"
+	,	[&]{  Keep( sac.fit(s3d::PAR, points) );  }
+	,	n*nof_hypotheses
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_RANSAC(Suite& suite)
+{
+	::Plane_Fitting<float>(suite);
+	::Plane_Fitting<double>(suite);
+}
@@ -0,0 +1,156 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/Registration/Registration.hpp"
+#include <cmath>
+
+
+using s3d::bench::Keep;
+
+
+template<class T>
+static void Surface(std::size_t const n, s3d::PointSet<T, 3>& points, s3d::PointSet<T, 3>& normals)
+{
+	for(std::size_t i = 0;  i < n;  ++i)
+		for(std::size_t j = 0;  j < n;  ++j)
+		{
+			T const
+				x = T(-1) + T(2)*i/(n - 1),  y = T(-1) + T(2)*j/(n - 1),
+				z = std::sin(2*x)*std::cos(3*y)/3,
+				zx = 2*std::cos(2*x)*std::cos(3*y)/3,  zy = -3*std::sin(2*x)*std::sin(3*y)/3;
+
+			points.push_back( s3d::Vector<T, 3>{x, y, z} );
+			normals.push_back( s3d::UnitVec<T, 3>(s3d::Vector<T, 3>{-zx, -zy, T(1)}).vec() );
+		}
+}
+
+
+template<class T>
+static void Align(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr n = 128, nof_iterations = 10;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::PointSet<T, 3> target, normals;
+
+	::Surface(n, target, normals);
+
+	auto const answer
+	=	s3d::Afn<T, 3>.rotate( s3d::UnitVec<T, 3>{1, -2, 3}, T(.15) ).translate( T(.1), T(-.05), T(.08) );
+
+	auto const source = target >> answer.inv();
+
+	//	no tolerance to stop at , so that every alignment runs the same iterations .
+	auto const flags = [&]{  return sgm::Flags( s3d::flag::Tolerance<T>(0), s3d::flag::Iteration_Cap(nof_iterations) );  };
+
+	s3d::Iterative_Closest_Point<T> p2p(s3d::PAR, target, flags());
+
+	s3d::Iterative_Closest_Point<T, s3d::ICP_Mode::POINT_TO_PLANE> p2l(s3d::PAR, target, normals, flags());
+
+	suite.measure
+	(	"Registration", "ICP point-to-point SEQ (per point iteration)", scalar, "16kx3", "fixed"
+	,	[&]{  Keep( p2p.align(s3d::SEQ, source) );  }
+	,	n*n*nof_iterations
+	);
+
+	suite.measure
+	(	"Registration", "ICP point-to-point PAR (per point iteration)", scalar, "16kx3", "fixed"
+	,	[&]{  Keep( p2p.align(s3d::PAR, source) );  }
+	,	n*n*nof_iterations
+	);
+
+	suite.measure
+	(	"Registration", "ICP point-to-plane PAR (per point iteration)", scalar, "16kx3", "fixed"
+	,	[&]{  Keep( p2l.align(s3d::PAR, source) );  }
+	,	n*n*nof_iterations
+	);
+}
+
+
+template<class T>
+static void Closed_Form(s3d::bench::Suite& suite)
+{
+	std::size_t constexpr n = 1 << 16;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	s3d::PointSet<T, 3> source(n);
+
+	for(std::size_t i = 0;  i < n;  ++i)
+		for(std::size_t d = 0;  d < 3;  ++d)
+			source(i, d) = s3d::bench::Random<T>(-10, 10);
+
+	auto const target
+	=	source >> s3d::Afn<T, 3>.rotate( s3d::UnitVec<T, 3>{1, -2, 3}, T(.5) ).translate( T(1), T(2), T(3) );
+
+	//	as done without streaming : centered 3xN copies , their product , and an SVD of dynamic size .
+	suite.measure
+	(	"Registration", "Kabsch over 3xN matrices (per pair)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			s3d::Matrix<T> P(3, n),  Q(3, n);
+			s3d::Vector<T, 3> pc = s3d::Vector<T, 3>::Zero(),  qc = s3d::Vector<T, 3>::Zero();
+
+			for(std::size_t i = 0;  i < n;  ++i)
+				pc += source(i),  qc += target(i);
+
+			pc /= T(n),  qc /= T(n);
+
+			for(std::size_t i = 0;  i < n;  ++i)
+				for(std::size_t d = 0;  d < 3;  ++d)
+					P(d, i) = source(i, d) - pc(d),  Q(d, i) = target(i, d) - qc(d);
+
+			s3d::Matrix<T> const H = P*Q.transpose();
+			s3d::Singular_Value_Decomposition const svd(H);
+
+			s3d::Matrix<T, 3, 3> const R = svd.Vmat()*svd.Umat().transpose();
+
+			Keep(R);
+		}
+	,	n
+	);
+
+	suite.measure
+	(	"Registration", "Alignment_Accumulator Kabsch (per pair)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			s3d::Alignment_Accumulator<T> acc;
+
+			for(std::size_t i = 0;  i < n;  ++i)
+				acc.push( source(i), target(i) );
+
+			Keep( acc.rigid_transform() );
+		}
+	,	n
+	);
+
+	suite.measure
+	(	"Registration", "Alignment_Accumulator Umeyama (per pair)", scalar, "64kx3", "fixed"
+	,	[&]
+		{
+			s3d::Alignment_Accumulator<T> acc;
+
+			for(std::size_t i = 0;  i < n;  ++i)
+				acc.push( source(i), target(i) );
+
+			Keep( acc.scalable_transform() );
+		}
+	,	n
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Registration(Suite& suite)
+{
+	::Closed_Form<float>(suite);
+	::Closed_Form<double>(suite);
+
+	::Align<float>(suite);
+	::Align<double>(suite);
+}
@@ -0,0 +1,58 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../../Bench_s3d.hpp"
+#include "S3D/Sparse/Sparse.hpp"
+#include <vector>
+
+
+using s3d::bench::Keep;
+using s3d::bench::Random;
+using s3d::bench::Random_Mat;
+
+
+template<class T>
+static void SparseMat_Operations(s3d::bench::Suite& suite)
+{
+	using Entry = typename s3d::SparseMat<T>::Entry;
+
+	std::size_t constexpr rows = 100'000, cols = 10'000, nnz_per_row = 4;
+
+	char const* const scalar = s3d::bench::Scalar_Name<T>();
+
+	std::vector<Entry> entries;
+
+	entries.reserve(rows*nnz_per_row);
+
+	for(std::size_t i = 0;  i < rows;  ++i)
+		for(std::size_t k = 0;  k < nnz_per_row;  ++k)
+			entries.push_back
+			(	Entry{ i, static_cast<std::size_t>( Random<T>(0, T(cols - 1)) ), Random<T>() }
+			);
+
+	s3d::SparseMat<T> const A(rows, cols, entries), At = A.transpose();
+	s3d::Vector<T> const v = Random_Mat< s3d::Vector<T> >(cols, 1), u = Random_Mat< s3d::Vector<T> >(rows, 1);
+
+	suite.measure
+	(	"Sparse", "SparseMat::operator*(Vector) (per nonzero)", scalar, "100kx10k", "DYNAMIC"
+	,	[&]{  Keep(A),  Keep(v);  s3d::Vector<T> const w = A*v;  Keep(w);  }
+	,	A.nof_nonzeros()
+	);
+
+	suite.measure
+	(	"Sparse", "SparseMat::transpose()*Vector (per nonzero)", scalar, "100kx10k", "DYNAMIC"
+	,	[&]{  Keep(At),  Keep(u);  s3d::Vector<T> const w = At*u;  Keep(w);  }
+	,	A.nof_nonzeros()
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+void s3d::bench::Bench_Sparse(Suite& suite)
+{
+	::SparseMat_Operations<float>(suite);
+	::SparseMat_Operations<double>(suite);
+}
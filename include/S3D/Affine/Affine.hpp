@@ -10,8 +10,11 @@
 
 
 #include "S3D/Euclid/Euclid.hpp"
+#include "S3D/Parallel/Parallel.hpp"
+#include "S3D/PointSet/PointSet.hpp"
 #include "S3D/Quaternion/Quaternion.hpp"
 #include "SGM/Wrapper/Boomerang.hpp"
+#include <iterator>
 
 
 namespace s3d
@@ -32,9 +35,21 @@ namespace s3d
 	template<class T, size_t DIM>
 	class Rotation;
 
+	template<class T>
+	class Cached_Rotation;
+
 	template<class T, size_t DIM>  
 	inline auto const Afn = Rigid_Body_Transform<T, DIM>();
 
+
+	struct _Batch_Transfer_Helper;
+
+
+	template<class POLICY, class RANGE, class A>
+	static auto transform_all
+	(	POLICY const& policy, RANGE& range, _Affine_interface<A> const& affine
+	)->	RANGE&;
+
 }
 
 
@@ -64,6 +79,11 @@ namespace s3d::trait
 	,	Rotation, <T, D>
 	);
 
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	class T
+	,	Cached_Rotation, <T>
+	);
+
 }
 //========//========//========//========//=======#//========//========//========//========//=======#
 
@@ -89,20 +109,141 @@ public:
 template
 <	class LHS, class A, class = sgm::Enable_if_t< !s3d::trait::is_AffineTr<LHS>::value >  
 >
-static auto operator>>(LHS const& Lhs, s3d::_Affine_interface<A> const& affine)
-{
-	return affine.transfer(Lhs);  
-}
-
+static auto operator>>(LHS const& Lhs, s3d::_Affine_interface<A> const& affine);
 
 template
 <	class LHS, class A, class = sgm::Enable_if_t< !s3d::trait::is_AffineTr<LHS>::value >  
 >
-static decltype(auto) operator>>=(LHS& Lhs, s3d::_Affine_interface<A> const& affine)
+static decltype(auto) operator>>=(LHS& Lhs, s3d::_Affine_interface<A> const& affine);
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Transfers a whole batch of points with mat() and vec() evaluated only once .
+*	PointSet lanes are processed by a plain loop over the points which compilers vectorize 
+*	for the target instruction set , so no kernel has to be written per architecture .
+*/
+struct s3d::_Batch_Transfer_Helper : Unconstructible
+{
+	template<class POLICY, class CON, class A>
+	static void calc(POLICY const& policy, CON& con, _Affine_interface<A> const& affine)
+	{
+		using vec_t = Decay_t< decltype(affine.vec()) >;
+		using T = trait::value_t<vec_t>;
+		size_t constexpr DIM = vec_t::STT_ROW_SIZE;
+
+		if constexpr(trait::is_PointSet<CON>::value)
+		{
+			T m[DIM][DIM], v[DIM];
+			T* lanes[DIM];
+
+			{
+				auto const& mat = affine.mat();
+				auto const& vec = affine.vec();
+
+				for(size_t i = 0;  i < DIM;  ++i)
+				{
+					for(size_t j = 0;  j < DIM;  ++j)
+						m[i][j] = mat(i, j);
+
+					v[i] = vec(i),  lanes[i] = con.lane_data(i);
+				}
+			}
+
+			Parallel_for
+			(	policy, con.size(), sizeof(T)
+			,	[&](size_t const bi, size_t const ei){  _transfer_lanes<T, DIM>(lanes, m, v, bi, ei);  }
+			);
+		}
+		else if constexpr
+		(	trait::is_UnitVec< Decay_t<trait::Deref_t<CON>> >::value
+		||	trait::is_Affine_Transform<A>::value
+		)
+			_transfer_elems(policy, con, affine);
+		else
+			_transfer_elems( policy, con, Affine_Transform<T, DIM>(affine) );
+	}
+
+
+private:
+	template<class POLICY, class CON, class AFFINE>
+	static void _transfer_elems(POLICY const& policy, CON& con, AFFINE const& affine)
+	{
+		using itr_t = Decay_t< decltype(Begin(con)) >;
+
+		bool constexpr is_random_access_v
+		=	is_Convertible
+			<	typename std::iterator_traits<itr_t>::iterator_category
+			,	std::random_access_iterator_tag
+			>::	value;
+
+		if constexpr(is_random_access_v)
+		{
+			itr_t const bi = Begin(con);
+
+			Parallel_for
+			(	policy, Size(con), sizeof( Decay_t<decltype(*bi)> )
+			,	[&bi, &affine](size_t const b, size_t const e)
+				{
+					for(auto itr = Next(bi, b), ei = Next(bi, e);  itr != ei;  ++itr)
+						*itr >>= affine;
+				}
+			);
+		}
+		else
+			for(auto& t : con)
+				t >>= affine;
+	}
+
+
+	template<class T, size_t DIM>
+	static void _transfer_lanes
+	(	T* const (&lanes)[DIM], T const (&m)[DIM][DIM], T const (&v)[DIM]
+	,	size_t const bi, size_t const ei
+	)
+	{
+		for(size_t k = bi;  k < ei;  ++k)
+		{
+			T p[DIM];
+
+			for(size_t j = 0;  j < DIM;  ++j)
+				p[j] = lanes[j][k];
+
+			for(size_t i = 0;  i < DIM;  ++i)
+			{
+				T res = v[i];
+
+				for(size_t j = 0;  j < DIM;  ++j)
+					res += m[i][j]*p[j];
+
+				lanes[i][k] = res;
+			}
+		}
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+template<class LHS, class A, class>
+auto operator>>(LHS const& Lhs, s3d::_Affine_interface<A> const& affine)
+{
+	if constexpr(s3d::trait::is_PointSet<LHS>::value)
+	{
+		LHS res = Lhs;
+
+		s3d::_Batch_Transfer_Helper::calc(s3d::SEQ, res, affine);
+
+		return res;
+	}
+	else
+		return affine.transfer(Lhs);  
+}
+
+
+template<class LHS, class A, class>
+decltype(auto) operator>>=(LHS& Lhs, s3d::_Affine_interface<A> const& affine)
 {
-	if constexpr(sgm::is_iterable<LHS>::value)
-		for(auto& t : Lhs)
-			t >>= affine;
+	if constexpr(sgm::is_iterable<LHS>::value || s3d::trait::is_PointSet<LHS>::value)
+		s3d::_Batch_Transfer_Helper::calc(s3d::SEQ, Lhs, affine);
 	else
 		Lhs = Lhs >> affine;  
 
@@ -110,6 +251,24 @@ static decltype(auto) operator>>=(LHS& Lhs, s3d::_Affine_interface<A> const& aff
 }
 
 
+/**	Same as range >>= affine , but with PAR or Parallel_Policy{nof_threads, grain_size} the range 
+*	is split across threads . Ranges without random access are transferred sequentially .
+*/
+template<class POLICY, class RANGE, class A>
+auto s3d::transform_all
+(	POLICY const& policy, RANGE& range, _Affine_interface<A> const& affine
+)->	RANGE&
+{
+	static_assert(trait::is_Execution_Policy<POLICY>::value);
+	static_assert(is_iterable<RANGE>::value || trait::is_PointSet<RANGE>::value);
+
+	_Batch_Transfer_Helper::calc(policy, range, affine);
+
+	return range;
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 template<class A>
 class s3d::_Affine_interface
 {
@@ -691,7 +850,7 @@ public:
 	using scalar_type = T;
 
 
-	Rotation( T const angle = T(0) ) : _angle(angle){}
+	constexpr Rotation( T const angle = T(0) ) : _angle(angle){}
 	Rotation(OrthogonalMat<T, 2> const& m) : _angle( _from_OrthogonalMat(m) ){}
 
 
@@ -706,7 +865,7 @@ public:
 	auto operator=(Q&& q)-> Rotation&{  return *this = Rotation( Forward<Q>(q) );  }
 
 
-	auto inv() const-> Rotation{  return -angle();  }
+	constexpr auto inv() const-> Rotation{  return -angle();  }
 
 
 	auto cortho_mat() const-> OrthogonalMat<T, 2>{  return _to_OrthogonalMat(_angle);  }
@@ -722,11 +881,13 @@ public:
 	}
 
 
-	auto angle() const-> T{  return _angle;  }
+	constexpr auto angle() const-> T{  return _angle;  }
 
 
 	auto operator()(Vector<T, 2> const& v) const-> Vector<T, 2>{  return ortho_mat()*v;  }
-	auto operator()(UnitVec<T, 2> const& u) const-> UnitVec<T, 2>{  return (*this)(u.vec());  }
+	//	only for UnitVec itself , so that a type converting to both is taken as a Vector .
+	template<  class Q, class = Enable_if_t< trait::is_UnitVec<Q>::value >  >
+	auto operator()(Q const& u) const-> UnitVec<T, 2>{  return (*this)( u.vec() );  }
 
 
 	template<class...ARGS>
@@ -844,10 +1005,17 @@ public:
 	}
 
 
-	auto operator()(Vector<T, 3> const& v) const
-	->	Vector<T, 3>{  return ( _uqtn*Quaternion<T>(0, v)*_uqtn.inv() ).v();  }
+	//	v + w*t + u x t with t = 2 u x v for the unit quaternion ( w , u ) .
+	auto operator()(Vector<T, 3> const& v) const-> Vector<T, 3>
+	{
+		Vector<T, 3> const& u = _uqtn.v();
+		Vector<T, 3> const t = T(2)*u.cross(v);
+
+		return v + _uqtn.w()*t + u.cross(t);
+	}
 
-	auto operator()(UnitVec<T, 3> const &u) const-> UnitVec<T, 3>{  return (*this)(u.vec());  }
+	template<  class Q, class = Enable_if_t< trait::is_UnitVec<Q>::value >  >
+	auto operator()(Q const& u) const-> UnitVec<T, 3>{  return (*this)( u.vec() );  }
 
 
 	template<class...ARGS>
@@ -958,13 +1126,24 @@ private:
 		}
 	}
 
+	/**	Homogeneous form of the quaternion-to-matrix conversion .
+	*	Since q is already normalized , the result is orthogonal without re-orthonormalization .
+	*/
 	static auto _to_OrthogonamMat(_UQtn_t const& q)-> _OrthoMat_t
 	{
-		T const& w = q.w();
-		Vector<T, 3> const& v = q.v();
+		T const 
+			w = q.w(), x = q.v()(0), y = q.v()(1), z = q.v()(2),
+			ww = w*w, xx = x*x, yy = y*y, zz = z*z,
+			xy = x*y, xz = x*z, yz = y*z, wx = w*x, wy = w*y, wz = w*z;
 
-		return 
-		(w*w - v.sqr_norm())*OrthogonalMat<T, 3>::identity() + 2*w*v.skew() + 2*v.dyadic(v);
+		return
+		Skipped<_OrthoMat_t>
+		(	Matrix<T, 3, 3>
+			{	ww + xx - yy - zz,	T(2)*(xy - wz),		T(2)*(xz + wy)
+			,	T(2)*(xy + wz),		ww - xx + yy - zz,	T(2)*(yz - wx)
+			,	T(2)*(xz - wy),		T(2)*(yz + wx),		ww - xx - yy + zz
+			}
+		);
 	}
 };
 
@@ -991,4 +1170,64 @@ namespace s3d
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+/**	Rotation<T, 3> carrying its orthogonal matrix , for a rotation applied to many vectors 
+*	between changes . Opt-in , since the matrix triples the size and is rebuilt on every change .
+*	The matrix is built eagerly , so const member functions stay safe to share between threads .
+*/
+template<class T>
+class s3d::Cached_Rotation
+{
+private:
+	using _Rot_t = Rotation<T, 3>;
+	using _OrthoMat_t = OrthogonalMat<T, 3>;
+
+
+public:
+	using scalar_type = T;
+
+
+	Cached_Rotation() : Cached_Rotation( _Rot_t() ){}
+	Cached_Rotation(_Rot_t const& rot) : _rot(rot), _otm( rot.cortho_mat() ){}
+
+
+	auto operator=(_Rot_t const& rot)-> Cached_Rotation&{  return *this = Cached_Rotation(rot);  }
+
+
+	auto rotation() const-> _Rot_t const&{  return _rot;  }
+	operator _Rot_t const&() const{  return rotation();  }
+
+	auto cunit_qtn() const-> UnitQuaternion<T> const&{  return _rot.cunit_qtn();  }
+	auto cortho_mat() const-> _OrthoMat_t const&{  return _otm;  }
+
+
+	auto inv() const-> Cached_Rotation{  return _rot.inv();  }
+
+
+	auto operator()(Vector<T, 3> const& v) const-> Vector<T, 3>{  return _otm*v;  }
+
+	template<  class Q, class = Enable_if_t< trait::is_UnitVec<Q>::value >  >
+	auto operator()(Q const& u) const-> UnitVec<T, 3>{  return (*this)( u.vec() );  }
+
+
+	template<class...ARGS>
+	auto rotate(ARGS&&...args) const
+	->	Cached_Rotation{  return _rot.rotate( Forward<ARGS>(args)... );  }
+
+
+private:
+	_Rot_t _rot;
+	_OrthoMat_t _otm;
+};
+
+
+namespace s3d
+{
+
+	template<class T>
+	Cached_Rotation(Rotation<T, 3> const&)-> Cached_Rotation<T>;
+
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 #endif // end of #ifndef _S3D_AFFINE_
\ No newline at end of file
@@ -0,0 +1,566 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_BVH_
+#define _S3D_BVH_
+
+
+#include "S3D/Euclid/Euclid.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace s3d
+{
+
+	template<class PRIM>
+	class BVH;
+
+
+	template<class PRIM>
+	struct _BVH_Key;
+
+}
+
+
+namespace s3d::trait
+{
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	class PRIM
+	,	BVH, <PRIM>
+	);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+/**	Every primitive is a point in a key space where a box bounds sqrDistance from below :
+*	a point is the key of itself , a plane is ( n, n.x ) and a 3D line is its Plucker coordinates
+*	( t, x X t ) . Planes and lines are unbounded , so that boxes around them in the space they
+*	live in would be infinite and prune nothing .
+*	Positions are taken as x' = (x - origin)*scale , which brings offsets and moments to the range
+*	of unit normals and tangents . Normals and tangents are signed so that their largest
+*	components are positive , because ( -n, -n.x ) and ( -t, -(x X t) ) are the same primitives .
+*/
+template<class PRIM>
+struct s3d::_BVH_Key : Unconstructible
+{
+	using value_type = trait::value_t<PRIM>;
+	static size_t constexpr DIMENSION = trait::Dimension<PRIM>::value;
+
+	static_assert
+	(	trait::is_StrictVec<PRIM>::value || trait::is_Plane<PRIM>::value
+	||	(trait::is_Line<PRIM>::value && DIMENSION == 3)
+	);
+
+	static size_t constexpr SIZE
+	=	trait::is_Plane<PRIM>::value ? DIMENSION + 1
+	:	trait::is_Line<PRIM>::value ? 2*DIMENSION
+	:	DIMENSION;
+
+	using key_t = std::array<value_type, SIZE>;
+	using query_t = Vector<value_type, DIMENSION>;
+
+
+	static auto position(PRIM const& prim)-> query_t
+	{
+		if constexpr(trait::is_StrictVec<PRIM>::value)
+			return prim;
+		else
+			return prim.position();
+	}
+
+
+	static auto of(PRIM const& prim, query_t const& origin, value_type const scale)-> key_t
+	{
+		query_t const x = ( position(prim) - origin )*scale;
+
+		key_t res;
+
+		if constexpr(trait::is_StrictVec<PRIM>::value)
+			for(size_t d = 0;  d < DIMENSION;  ++d)
+				res[d] = x(d);
+		else if constexpr(trait::is_Plane<PRIM>::value)
+		{
+			query_t const n = _signed( prim.normal().vec() );
+
+			for(size_t d = 0;  d < DIMENSION;  ++d)
+				res[d] = n(d);
+
+			res[DIMENSION] = n.dot(x);
+		}
+		else if constexpr(trait::is_Line<PRIM>::value)
+		{
+			query_t const t = _signed( prim.tangent().vec() ),  m = x.cross(t);
+
+			for(size_t d = 0;  d < 3;  ++d)
+				res[d] = t(d),  res[d + 3] = m(d);
+		}
+
+		return res;
+	}
+
+
+	/**	Lower bound of sqrDistance from q to any primitive whose key lies in [lo, hi] ,
+	*	where q and the result are in the scaled space of keys . Every key component is within
+	*	[-1, 1] there , so that gaps are shrunk by a slack for rounding errors in proportion to |q| .
+	*/
+	static auto sqr_dist_bound
+	(	query_t const& q, value_type const (&lo)[SIZE], value_type const (&hi)[SIZE]
+	)->	value_type
+	{
+		using T = value_type;
+
+		T slack = 1;
+
+		for(size_t d = 0;  d < DIMENSION;  ++d)
+			slack += std::abs( q(d) );
+
+		slack *= T(8)*std::numeric_limits<T>::epsilon();
+
+		T res = 0;
+
+		if constexpr(trait::is_StrictVec<PRIM>::value)
+			for(size_t d = 0;  d < DIMENSION;  ++d)
+				res += _sqr_gap(lo[d] - q(d), hi[d] - q(d), slack);
+		else if constexpr(trait::is_Plane<PRIM>::value)
+		{
+			//	interval of n.q - c
+			T a = -hi[DIMENSION],  b = -lo[DIMENSION];
+
+			for(size_t d = 0;  d < DIMENSION;  ++d)
+				_widen(a, b, q(d), lo[d], hi[d]);
+
+			res = _sqr_gap(a, b, slack);
+		}
+		else if constexpr(trait::is_Line<PRIM>::value)
+			//	interval of each component of q X t - m
+			for(size_t i = 0;  i < 3;  ++i)
+			{
+				size_t const j = (i + 1) % 3,  k = (i + 2) % 3;
+
+				T a = -hi[i + 3],  b = -lo[i + 3];
+
+				_widen(a, b, q(j), lo[k], hi[k]),  _widen(a, b, -q(k), lo[j], hi[j]);
+
+				res += _sqr_gap(a, b, slack);
+			}
+
+		return res;
+	}
+
+
+private:
+	static auto _signed(query_t const& u)-> query_t
+	{
+		size_t imax = 0;
+
+		for(size_t d = 1;  d < DIMENSION;  ++d)
+			if( std::abs(u(d)) > std::abs(u(imax)) )
+				imax = d;
+
+		return u(imax) < 0 ? query_t(-u) : u;
+	}
+
+
+	//	[a, b] += c*[lo, hi]
+	static void _widen
+	(	value_type& a, value_type& b, value_type const c, value_type const lo, value_type const hi
+	)
+	{
+		value_type const u = c*lo,  v = c*hi;
+
+		a += std::min(u, v),  b += std::max(u, v);
+	}
+
+
+	//	square of the gap between 0 and [a - slack, b + slack]
+	static auto _sqr_gap(value_type const a, value_type const b, value_type const slack)
+	->	value_type
+	{
+		value_type const g = std::max({a - slack, -b - slack, value_type(0)});
+
+		return g*g;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Bounding volume hierarchy over points , planes or 3D lines for nearest queries from points .
+*	Nodes are boxes in the key space of _BVH_Key , built by binned SAH and flattened in depth first
+*	order : the first child of an interior node follows it and the second one is at its offset .
+*	Primitives are copied in the order of leaves , so that a leaf reads a contiguous range .
+*/
+template<class PRIM>
+class s3d::BVH
+{
+private:
+	using _Key = _BVH_Key<PRIM>;
+	using _key_t = typename _Key::key_t;
+
+	static size_t constexpr _K = _Key::SIZE;
+
+
+public:
+	using value_type = typename _Key::value_type;
+	using primitive_t = PRIM;
+	using query_t = typename _Key::query_t;
+	static size_t constexpr DIMENSION = _Key::DIMENSION;
+
+
+	BVH() = default;
+
+	template<  class CON, class = Enable_if_t< is_iterable<CON>::value >  >
+	explicit BVH(CON const& prims)
+	{
+		for(auto const& p : prims)
+			_prims.push_back(p);
+
+		assert( _prims.size() < std::numeric_limits<uint32_t>::max() );
+
+		_indices.resize(_prims.size());
+
+		for(size_t i = 0;  i < _indices.size();  ++i)
+			_indices[i] = i;
+
+		if(_prims.empty())
+			return;
+
+		_origin = query_t::Zero();
+
+		for(auto const& p : _prims)
+			_origin += _Key::position(p);
+
+		_origin /= static_cast<value_type>(_prims.size());
+
+		value_type radius = 0;
+
+		for(auto const& p : _prims)
+			radius = std::max( radius, (_Key::position(p) - _origin).norm() );
+
+		_scale = radius > 0 ? value_type(1) / radius : value_type(1);
+
+		std::vector<_key_t> keys;
+
+		keys.reserve(_prims.size());
+
+		for(auto const& p : _prims)
+			keys.push_back( _Key::of(p, _origin, _scale) );
+
+		_nodes.reserve( 2*_prims.size()/_LEAF_SIZE + 1 );
+
+		_build(keys, 0, _prims.size(), 0);
+
+		std::vector<PRIM> ordered;
+
+		ordered.reserve(_prims.size());
+
+		for(auto const i : _indices)
+			ordered.push_back(_prims[i]);
+
+		_prims.swap(ordered);
+	}
+
+
+	auto size() const-> size_t{  return _prims.size();  }
+	auto empty() const-> bool{  return _prims.empty();  }
+	auto nof_nodes() const-> size_t{  return _nodes.size();  }
+
+
+	auto nearest(query_t const& q) const-> Nullable< Neighbor<value_type> >
+	{
+		if(empty())
+			return Null_t{};
+
+		return _Neighbor_Search::nearest<value_type>( _search_f(q) );
+	}
+
+
+	//	The min(k, size()) nearest primitives in ascending order of sqrDistance .
+	auto nearest(query_t const& q, size_t const k) const-> std::vector< Neighbor<value_type> >
+	{
+		std::vector< Neighbor<value_type> > res( std::min(k, size()) );
+
+		_Neighbor_Search::k_nearest( res.size(), res.data(), _search_f(q) );
+
+		return res;
+	}
+
+
+	//	All primitives no farther than radius in ascending order of sqrDistance .
+	auto within(query_t const& q, value_type const radius) const-> std::vector< Neighbor<value_type> >
+	{
+		std::vector< Neighbor<value_type> > res;
+
+		if(!empty())
+			_Neighbor_Search::within( radius, res, _search_f(q) );
+
+		return res;
+	}
+
+
+private:
+	struct _Node
+	{
+		value_type lo[_K], hi[_K];
+		uint32_t offset; // first primitive of a leaf , or the second child of an interior node
+		uint32_t count; // 0 for interior nodes
+	};
+
+
+	static size_t constexpr _LEAF_SIZE = 16, _NOF_BINS = 16, _SAH_DEPTH = 24;
+
+	//	Below _SAH_DEPTH nodes are split at medians , so that no path is longer than
+	//	_SAH_DEPTH + 32 and a fixed stack is enough for traversal .
+	static size_t constexpr _STACK_SIZE = 64;
+
+
+	std::vector<_Node> _nodes;
+	std::vector<PRIM> _prims;
+	std::vector<size_t> _indices;
+	query_t _origin = query_t::Zero();
+	value_type _scale = 1;
+
+
+	static auto _infinity()-> value_type{  return std::numeric_limits<value_type>::infinity();  }
+
+
+	static auto _area(value_type const (&lo)[_K], value_type const (&hi)[_K])-> value_type
+	{
+		value_type res = 0;
+
+		for(size_t i = 0;  i < _K;  ++i)
+			for(size_t j = i + 1;  j < _K;  ++j)
+				res += (hi[i] - lo[i])*(hi[j] - lo[j]);
+
+		return res;
+	}
+
+
+	static void _expand
+	(	value_type (&lo)[_K], value_type (&hi)[_K], _key_t const& key
+	)
+	{
+		for(size_t d = 0;  d < _K;  ++d)
+			lo[d] = std::min(lo[d], key[d]),  hi[d] = std::max(hi[d], key[d]);
+	}
+
+
+	auto _build
+	(	std::vector<_key_t> const& keys, size_t const bi, size_t const ei, size_t const depth
+	)->	size_t
+	{
+		size_t const node_idx = _nodes.size();
+
+		_nodes.emplace_back();
+
+		{
+			_Node& node = _nodes.back();
+
+			std::fill(node.lo, node.lo + _K, _infinity()),  std::fill(node.hi, node.hi + _K, -_infinity());
+
+			for(size_t i = bi;  i < ei;  ++i)
+				_expand(node.lo, node.hi, keys[_indices[i]]);
+
+			node.offset = static_cast<uint32_t>(bi),  node.count = static_cast<uint32_t>(ei - bi);
+		}
+
+		if(ei - bi <= _LEAF_SIZE)
+			return node_idx;
+
+		_Node const node = _nodes[node_idx];
+
+		size_t axis = 0;
+
+		for(size_t d = 1;  d < _K;  ++d)
+			if(node.hi[d] - node.lo[d] > node.hi[axis] - node.lo[axis])
+				axis = d;
+
+		//	keys are all the same .
+		if( !(node.hi[axis] > node.lo[axis]) )
+			return node_idx;
+
+		size_t mid
+		=	depth < _SAH_DEPTH && _area(node.lo, node.hi) > 0
+			?	_sah_split(keys, bi, ei, axis, node.lo[axis], node.hi[axis])
+			:	bi;
+
+		if(mid == bi || mid == ei)
+		{
+			mid = bi + (ei - bi)/2;
+
+			std::nth_element
+			(	_indices.begin() + bi, _indices.begin() + mid, _indices.begin() + ei
+			,	[&keys, axis](size_t const i, size_t const j){  return keys[i][axis] < keys[j][axis];  }
+			);
+		}
+
+		_build(keys, bi, mid, depth + 1);
+
+		size_t const second = _build(keys, mid, ei, depth + 1);
+
+		_nodes[node_idx].offset = static_cast<uint32_t>(second),  _nodes[node_idx].count = 0;
+
+		return node_idx;
+	}
+
+
+	//	Partitions [bi, ei) at the bin boundary of least surface area heuristic cost .
+	auto _sah_split
+	(	std::vector<_key_t> const& keys, size_t const bi, size_t const ei, size_t const axis
+	,	value_type const cmin, value_type const cmax
+	)->	size_t
+	{
+		struct Bin
+		{
+			value_type lo[_K], hi[_K];
+			size_t count;
+		};
+
+		value_type const scale = value_type(_NOF_BINS) / (cmax - cmin);
+
+		auto const bin_f
+		=	[&keys, axis, cmin, scale](size_t const i)
+			{
+				return
+				std::min( static_cast<size_t>( (keys[i][axis] - cmin)*scale ), _NOF_BINS - 1 );
+			};
+
+		Bin bins[_NOF_BINS];
+
+		for(auto& bin : bins)
+			std::fill(bin.lo, bin.lo + _K, _infinity()),  std::fill(bin.hi, bin.hi + _K, -_infinity()),
+			bin.count = 0;
+
+		for(size_t i = bi;  i < ei;  ++i)
+		{
+			Bin& bin = bins[ bin_f(_indices[i]) ];
+
+			_expand(bin.lo, bin.hi, keys[_indices[i]]),  ++bin.count;
+		}
+
+		//	costs[s] for the split between bins[s] and bins[s + 1]
+		value_type costs[_NOF_BINS - 1];
+
+		{
+			Bin acc{};
+
+			std::fill(acc.lo, acc.lo + _K, _infinity()),  std::fill(acc.hi, acc.hi + _K, -_infinity());
+
+			for(size_t s = 0;  s + 1 < _NOF_BINS;  ++s)
+			{
+				for(size_t d = 0;  d < _K;  ++d)
+					acc.lo[d] = std::min(acc.lo[d], bins[s].lo[d]),
+					acc.hi[d] = std::max(acc.hi[d], bins[s].hi[d]);
+
+				acc.count += bins[s].count;
+
+				costs[s] = acc.count == 0 ? _infinity() : acc.count*_area(acc.lo, acc.hi);
+			}
+
+			std::fill(acc.lo, acc.lo + _K, _infinity()),  std::fill(acc.hi, acc.hi + _K, -_infinity());
+			acc.count = 0;
+
+			for(size_t s = _NOF_BINS - 1;  s > 0;  --s)
+			{
+				for(size_t d = 0;  d < _K;  ++d)
+					acc.lo[d] = std::min(acc.lo[d], bins[s].lo[d]),
+					acc.hi[d] = std::max(acc.hi[d], bins[s].hi[d]);
+
+				acc.count += bins[s].count;
+
+				costs[s - 1] += acc.count == 0 ? _infinity() : acc.count*_area(acc.lo, acc.hi);
+			}
+		}
+
+		size_t const best = std::min_element(costs, costs + _NOF_BINS - 1) - costs;
+
+		return
+		std::partition
+		(	_indices.begin() + bi, _indices.begin() + ei
+		,	[&bin_f, best](size_t const i){  return bin_f(i) <= best;  }
+		) - _indices.begin();
+	}
+
+
+	auto _search_f(query_t const& q) const
+	{
+		return
+		[this, &q](value_type& bound, auto&& visit_f){  _search(q, bound, visit_f);  };
+	}
+
+
+	/**	Visits primitives of the leaves whose lower bounds are no greater than bound ,
+	*	nearer child first . visit_f(index, sqr_dist, bound) may tighten bound .
+	*/
+	template<class F>
+	void _search(query_t const& q, value_type& bound, F&& visit_f) const
+	{
+		struct Entry
+		{
+			size_t node_idx;
+			value_type sqr_dist_bound;
+		};
+
+		query_t const sq = (q - _origin)*_scale;
+		value_type const unscale = value_type(1) / (_scale*_scale);
+
+		auto const bound_f
+		=	[&sq, unscale](_Node const& node){  return unscale*_Key::sqr_dist_bound(sq, node.lo, node.hi);  };
+
+		Entry stack[_STACK_SIZE];
+		size_t top = 0;
+
+		stack[top++] = {0, bound_f(_nodes[0])};
+
+		while(top > 0)
+		{
+			Entry const entry = stack[--top];
+
+			if(entry.sqr_dist_bound > bound)
+				continue;
+
+			_Node const& node = _nodes[entry.node_idx];
+
+			if(node.count > 0)
+			{
+				for(size_t i = node.offset, ei = i + node.count;  i < ei;  ++i)
+					visit_f( _indices[i], static_cast<value_type>( sqrDistance(q, _prims[i]) ), bound );
+
+				continue;
+			}
+
+			size_t const c1 = entry.node_idx + 1,  c2 = node.offset;
+
+			value_type const b1 = bound_f(_nodes[c1]),  b2 = bound_f(_nodes[c2]);
+
+			assert(top + 2 <= _STACK_SIZE);
+
+			if(b1 <= b2)
+				stack[top++] = {c2, b2},  stack[top++] = {c1, b1};
+			else
+				stack[top++] = {c1, b1},  stack[top++] = {c2, b2};
+		}
+	}
+};
+
+
+namespace s3d
+{
+
+	template<  class CON, class = Enable_if_t< is_iterable<CON>::value >  >
+	BVH(CON const&)-> BVH< Decay_t< trait::Deref_t<CON> > >;
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#endif // end of #ifndef _S3D_BVH_
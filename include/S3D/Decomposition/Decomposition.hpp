@@ -10,7 +10,11 @@
 
 
 #include "S3D/Hamilton/Hamilton.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+#include "S3D/Parallel/Parallel.hpp"
+#include "S3D/Sparse/Sparse.hpp"
 #include "SGM/Utility/Flag_Set.hpp"
+#include <utility>
 
 
 namespace s3d
@@ -22,17 +26,25 @@ namespace s3d
 	template<class T, size_t ROWS, size_t COLS, Storing_Order STOR, bool IS_REAL_SYMMETRIC>
 	class Eigen_Decomposition;
 	
+	template<class T, size_t DIM>
+	class Symmetric_Eigen_Batch;
+
 	template<class T, size_t ROWS, size_t COLS, Storing_Order STOR>
 	class Singular_Value_Decomposition;
 
+	template<class T, size_t DIM>
+	class Singular_Value_Batch;
+
 	
 	struct Least_Square_Problem;
 
 	enum class Solving_Mode;
 
+	template<class T, size_t ROWS, size_t COLS, Storing_Order STOR, Solving_Mode SM>
+	class Least_Square_Solver;
 
-	template<Solving_Mode>
-	class _Least_Square_Solution_Helper;
+	template<class T>
+	struct Convergence_Stats;
 
 }
 //========//========//========//========//=======#//========//========//========//========//=======#
@@ -67,6 +79,24 @@ namespace s3d::flag
 	,	Truncated, <FLAG>
 	);
 
+
+	// for iterative least square solvers
+	enum class Preconditioned;
+
+	template<class T = float>
+	struct Tolerance;
+
+	struct Iteration_Cap;
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	class FLAG
+	,	Tolerance, <FLAG>
+	);
+
+	template<class FLAG>
+	struct is_Iteration_Cap;
+
 }
 //========//========//========//========//=======#//========//========//========//========//=======#
 
@@ -146,8 +176,11 @@ public:
 	decltype(auto) eigenval(size_t const idx) const{  return _impl.eigenval(idx);  }
 	decltype(auto) eigenvec(size_t const idx) const{  return _impl.eigenvec(idx);  }
 
-	decltype(auto) diagmat() const{  return _impl.diagmat();  }
+	decltype(auto) diagmat() const&{  return _impl.diagmat();  }
 	decltype(auto) basemat() const{  return _impl.basemat();  }
+
+	//	diagmat() reads the eigenvalues in place , so a temporary gives an evaluated copy instead .
+	auto diagmat() &&{  return Decay_t<decltype( _impl.basemat() )>( _impl.diagmat() );  }
 };
 
 
@@ -165,6 +198,100 @@ namespace s3d
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+/**	Eigen decompositions of many real symmetric DIMxDIM matrices at once , DIM being 2 or 3 .
+*	Input matrices are given as a PointSet whose lanes hold the upper triangular entries in
+*	row-wise order , e.g. (0,0), (0,1), (0,2), (1,1), (1,2), (2,2) for DIM = 3 .
+*	Results are laid out the same way : eigenvals() holds the eigenvalues of every matrix in
+*	increasing order , and eigenvecs(k) holds the unit eigenvectors for the k-th of them .
+*/
+template<class T, std::size_t DIM>
+class s3d::Symmetric_Eigen_Batch : public Decomposition
+{
+private:
+	class _impl_t;
+
+	using _Default_Flag_Set = Flag_Set<>;
+
+public:
+	static_assert( trait::is_real<T>::value && (DIM == 2 || DIM == 3) );
+
+	static size_t constexpr NOF_ENTRIES = DIM*(DIM + 1)/2;
+
+	using input_t = PointSet<T, NOF_ENTRIES>;
+
+
+	Symmetric_Eigen_Batch() = default;
+
+	template
+	<	class POLICY, class FS = _Default_Flag_Set
+	,	class 
+		=	Enable_if_t
+			<	trait::is_Execution_Policy<POLICY>::value && is_Flag_Set<FS>::value
+			>  
+	>
+	Symmetric_Eigen_Batch(POLICY&& policy, input_t const& mats, FS&& fs = {})
+	{
+		(*this)( Forward<POLICY>(policy), mats, Forward<FS>(fs) );
+	}
+
+	template<  class FS = _Default_Flag_Set, class = Enable_if_t< is_Flag_Set<FS>::value >  >
+	Symmetric_Eigen_Batch(input_t const& mats, FS&& fs = {})
+	:	Symmetric_Eigen_Batch( SEQ, mats, Forward<FS>(fs) ){}
+
+
+	template
+	<	class POLICY, class FS = _Default_Flag_Set
+	,	class 
+		=	Enable_if_t
+			<	trait::is_Execution_Policy<POLICY>::value && is_Flag_Set<FS>::value
+			>  
+	>
+	auto operator()(POLICY&& policy, input_t const& mats, FS&& = {})-> Symmetric_Eigen_Batch&
+	{
+		bool constexpr WITH_VECTORS = !Has_Flag<flag::Value_Only, FS>::value;
+
+		_eigenvals.resize( mats.size() );
+
+		for(auto& vecs : _eigenvecs)
+			vecs.resize(WITH_VECTORS ? mats.size() : 0);
+
+		auto chunk_f
+		=	[this, &mats](size_t const bi, size_t const ei)
+			{
+				_impl_t::template calc<WITH_VECTORS>(mats, _eigenvals, _eigenvecs, bi, ei);  
+			};
+
+		Parallel_for(policy, mats.size(), sizeof(T), chunk_f);
+
+		return *this;
+	}
+
+	template<  class FS = _Default_Flag_Set, class = Enable_if_t< is_Flag_Set<FS>::value >  >
+	auto operator()(input_t const& mats, FS&& fs = {})-> Symmetric_Eigen_Batch&
+	{
+		return (*this)( SEQ, mats, Forward<FS>(fs) );
+	}
+
+
+	auto size() const-> size_t{  return _eigenvals.size();  }
+
+	auto eigenvals() const-> PointSet<T, DIM> const&{  return _eigenvals;  }
+	auto eigenvecs(size_t const k) const-> PointSet<T, DIM> const&{  return _eigenvecs[k];  }
+
+	auto eigenval(size_t const idx, size_t const k) const-> T{  return _eigenvals(idx, k);  }
+	
+	auto eigenvec(size_t const idx, size_t const k) const-> Vector<T, DIM>
+	{
+		return _eigenvecs[k].point(idx);  
+	}
+
+
+private:
+	PointSet<T, DIM> _eigenvals, _eigenvecs[DIM];
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 template<class T, std::size_t ROWS, std::size_t COLS, s3d::Storing_Order STOR>
 class s3d::Singular_Value_Decomposition : public Decomposition
 {
@@ -196,15 +323,23 @@ public:
 	}
 
 
-	decltype(auto) Ucol(size_t const idx) const{  return _impl.Ucol(idx);  }
-	decltype(auto) Vcol(size_t const idx) const{  return _impl.Vcol(idx);  }
+	decltype(auto) Ucol(size_t const idx) const&{  return _impl.Ucol(idx);  }
+	decltype(auto) Vcol(size_t const idx) const&{  return _impl.Vcol(idx);  }
 
 	auto nof_singularvals() const-> size_t{  return _impl.nof_singularvals();  }
 	auto singularval(size_t const idx) const-> T{  return _impl.singularval(idx);  }
-	
-	decltype(auto) diagmat() const{  return _impl.diagmat();  }
-	decltype(auto) Umat() const{  return _impl.Umat();  }
-	decltype(auto) Vmat() const{  return _impl.Vmat();  }
+
+	//	Views into the workspaces of this object , valid until it is decomposing again or gone .
+	decltype(auto) diagmat() const&{  return _impl.diagmat();  }
+	decltype(auto) Umat() const&{  return _impl.Umat();  }
+	decltype(auto) Vmat() const&{  return _impl.Vmat();  }
+
+	//	A temporary would leave the views dangling , so that it gives evaluated copies instead .
+	auto Ucol(size_t const idx) &&-> Vector<T>{  return _impl.Ucol(idx);  }
+	auto Vcol(size_t const idx) &&-> Vector<T>{  return _impl.Vcol(idx);  }
+	auto diagmat() &&-> DynamicMat<T, STOR>{  return _impl.diagmat();  }
+	auto Umat() &&-> DynamicMat<T, STOR>{  return _impl.Umat();  }
+	auto Vmat() &&-> DynamicMat<T, STOR>{  return _impl.Vmat();  }
 };
 
 
@@ -221,24 +356,147 @@ namespace s3d
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+/**	Singular value decompositions of many DIMxDIM matrices at once , DIM being 2 or 3 .
+*	Input matrices are given as a PointSet whose lanes hold the entries in row-wise order .
+*	singularvals() holds the singular values of every matrix in decreasing order ,
+*	and Ucols(k) and Vcols(k) hold the k-th columns of U and V respectively .
+*	Every decomposition runs on the stack without any heap allocation .
+*/
+template<class T, std::size_t DIM>
+class s3d::Singular_Value_Batch : public Decomposition
+{
+private:
+	class _impl_t;
+
+	using _Default_Flag_Set = Flag_Set<>;
+
+public:
+	static_assert( trait::is_real<T>::value && (DIM == 2 || DIM == 3) );
+
+	using input_t = PointSet<T, DIM*DIM>;
+
+
+	Singular_Value_Batch() = default;
+
+	template
+	<	class POLICY, class FS = _Default_Flag_Set
+	,	class 
+		=	Enable_if_t
+			<	trait::is_Execution_Policy<POLICY>::value && is_Flag_Set<FS>::value
+			>  
+	>
+	Singular_Value_Batch(POLICY&& policy, input_t const& mats, FS&& fs = {})
+	{
+		(*this)( Forward<POLICY>(policy), mats, Forward<FS>(fs) );
+	}
+
+	template<  class FS = _Default_Flag_Set, class = Enable_if_t< is_Flag_Set<FS>::value >  >
+	Singular_Value_Batch(input_t const& mats, FS&& fs = {})
+	:	Singular_Value_Batch( SEQ, mats, Forward<FS>(fs) ){}
+
+
+	template
+	<	class POLICY, class FS = _Default_Flag_Set
+	,	class 
+		=	Enable_if_t
+			<	trait::is_Execution_Policy<POLICY>::value && is_Flag_Set<FS>::value
+			>  
+	>
+	auto operator()(POLICY&& policy, input_t const& mats, FS&& = {})-> Singular_Value_Batch&
+	{
+		bool constexpr
+			VALUE_ONLY = Has_Flag<flag::Value_Only, FS>::value,
+			WITH_U = !VALUE_ONLY && !Has_Flag<flag::VMat_Only, FS>::value,
+			WITH_V = !VALUE_ONLY && !Has_Flag<flag::UMat_Only, FS>::value;
+
+		_singularvals.resize( mats.size() );
+
+		for(size_t k = 0;  k < DIM;  ++k)
+			_Ucols[k].resize(WITH_U ? mats.size() : 0),
+			_Vcols[k].resize(WITH_V ? mats.size() : 0);
+
+		auto chunk_f
+		=	[this, &mats](size_t const bi, size_t const ei)
+			{
+				_impl_t::template calc<WITH_U, WITH_V>
+				(	mats, _singularvals, _Ucols, _Vcols, bi, ei
+				);
+			};
+
+		Parallel_for(policy, mats.size(), sizeof(T), chunk_f);
+
+		return *this;
+	}
+
+	template<  class FS = _Default_Flag_Set, class = Enable_if_t< is_Flag_Set<FS>::value >  >
+	auto operator()(input_t const& mats, FS&& fs = {})-> Singular_Value_Batch&
+	{
+		return (*this)( SEQ, mats, Forward<FS>(fs) );
+	}
+
+
+	auto size() const-> size_t{  return _singularvals.size();  }
+
+	auto singularvals() const-> PointSet<T, DIM> const&{  return _singularvals;  }
+	auto Ucols(size_t const k) const-> PointSet<T, DIM> const&{  return _Ucols[k];  }
+	auto Vcols(size_t const k) const-> PointSet<T, DIM> const&{  return _Vcols[k];  }
+
+	auto singularval(size_t const idx, size_t const k) const-> T{  return _singularvals(idx, k);  }
+	
+	auto Ucol(size_t const idx, size_t const k) const-> Vector<T, DIM>
+	{
+		return _Ucols[k].point(idx);  
+	}
+
+	auto Vcol(size_t const idx, size_t const k) const-> Vector<T, DIM>
+	{
+		return _Vcols[k].point(idx);  
+	}
+
+	auto Umat(size_t const idx) const-> Matrix<T, DIM, DIM>{  return _gather(_Ucols, idx);  }
+	auto Vmat(size_t const idx) const-> Matrix<T, DIM, DIM>{  return _gather(_Vcols, idx);  }
+
+
+private:
+	PointSet<T, DIM> _singularvals, _Ucols[DIM], _Vcols[DIM];
+
+
+	static auto _gather(PointSet<T, DIM> const (&cols)[DIM], size_t const idx)
+	->	Matrix<T, DIM, DIM>
+	{
+		Matrix<T, DIM, DIM> res;
+
+		for(size_t k = 0;  k < DIM;  ++k)
+			for(size_t d = 0;  d < DIM;  ++d)
+				res(d, k) = cols[k](idx, d);
+
+		return res;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 template<class T>
 struct s3d::flag::Truncated
 {
 protected:
+	//	Leading values and columns stay where they are , so that COL_FIRST storages shrink in place .
 	template<Storing_Order STOR>
 	static void _cut
 	(	size_t const nof_valid, Vector<T>& values
 	,	DynamicMat<T, STOR>& U, DynamicMat<T, STOR>& V
 	)
 	{
-		Vector<T> _values(nof_valid);
-		DynamicMat<T, STOR> _U(U.rows(), nof_valid), _V(V.rows(), nof_valid);
+		auto cut_f 
+		=	[nof_valid](auto& m)
+			{  
+				size_t const cols = m.cols() < nof_valid ? m.cols() : nof_valid;
 
-		for(size_t idx = 0;  idx < nof_valid;  ++idx)
-			_values(idx) = values(idx),
-			_U.col(idx) = U.col(idx),  _V.col(idx) = V.col(idx);
+				m.conservativeResize( static_cast<int>(m.rows()), static_cast<int>(cols) );  
+			};
 
-		values = Move(_values),  U = Move(_U),  V = Move(_V);
+		_Mat_implementor(values).conservativeResize( static_cast<int>(nof_valid) );
+		cut_f( _Mat_implementor(U) ),  cut_f( _Mat_implementor(V) );
 	}
 
 
@@ -282,14 +540,18 @@ struct s3d::flag::RelativelyTrunc : Truncated<T>
 	RelativelyTrunc(T const cr) : cutoff_ratio(cr){}
 
 
-	template<Storing_Order STOR>
-	void cut(Vector<T>& values, DynamicMat<T, STOR>& U, DynamicMat<T, STOR>& V) const
+	auto nof_valid(Vector<T> const& values) const-> size_t
 	{
 		assert( cutoff_ratio >= T(0) && cutoff_ratio < T(1) );
 
-		size_t const nof_valid = Truncated<T>::_nof_valid( values, cutoff_ratio*values(0) );
+		return Truncated<T>::_nof_valid( values, cutoff_ratio*values(0) );
+	}
+
 
-		Truncated<T>::_cut(nof_valid, values, U, V);
+	template<Storing_Order STOR>
+	void cut(Vector<T>& values, DynamicMat<T, STOR>& U, DynamicMat<T, STOR>& V) const
+	{
+		Truncated<T>::_cut(nof_valid(values), values, U, V);
 	}
 
 
@@ -303,12 +565,16 @@ struct s3d::flag::AbsolutelyTrunc : Truncated<T>
 	AbsolutelyTrunc(T const cv) : cutoff_value(cv){}
 
 
+	auto nof_valid(Vector<T> const& values) const-> size_t
+	{
+		return Truncated<T>::_nof_valid(values, cutoff_value);
+	}
+
+
 	template<Storing_Order STOR>
 	void cut(Vector<T>& values, DynamicMat<T, STOR>& U, DynamicMat<T, STOR>& V) const
 	{
-		size_t const nof_valid = Truncated<T>::_nof_valid(values, cutoff_value);
-
-		Truncated<T>::_cut(nof_valid, values, U, V);
+		Truncated<T>::_cut(nof_valid(values), values, U, V);
 	}
 
 
@@ -317,13 +583,146 @@ struct s3d::flag::AbsolutelyTrunc : Truncated<T>
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
-enum class s3d::Solving_Mode{QR, SVD, CHOLESKY};
+template<class T>
+struct s3d::flag::Tolerance
+{
+	Tolerance(T const tol) : tolerance(tol){}
+
+
+	T tolerance;
+};
+
+
+struct s3d::flag::Iteration_Cap
+{
+	Iteration_Cap(size_t const n) : max_iterations(n){}
+
+
+	size_t max_iterations;
+};
+
+
+template<class FLAG>
+struct s3d::flag::is_Iteration_Cap : is_Same< Decay_t<FLAG>, Iteration_Cap >{};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	QR, SVD and CHOLESKY factorize a dense design matrix directly .
+*	LSQR and CG(CGLS) iterate only on products with a SparseMat and its transpose , so that 
+*	a large sparse problem is solved without ever being densified .
+*/
+enum class s3d::Solving_Mode{QR, SVD, CHOLESKY, LSQR, CG};
+
+
+template<class T>
+struct s3d::Convergence_Stats
+{
+	size_t nof_iterations = 0;
+	T residual_norm = 0;  // |b - Ax|
+	T normal_residual_norm = 0;  // |A^T (b - Ax)|
+	bool converged = false;
+};
+
+
+/**	Factorizes a design matrix A once by the chosen Solving_Mode and then finds least square
+*	solutions x minimizing |Ax - b| for as many right-hand sides b as needed .
+*	Several right-hand sides gathered as columns of B are solved together by solve(B) .
+*	Iterative modes take flag::Tolerance , flag::Iteration_Cap and flag::Preconditioned (Jacobi
+*	column scaling) , and report how a solve went by solve_with_stats(B) . Solving keeps the
+*	solver unchanged , so that threads can share one .
+*/
+template<class T, std::size_t ROWS, std::size_t COLS, s3d::Storing_Order STOR, s3d::Solving_Mode SM>
+class s3d::Least_Square_Solver : public Decomposition
+{
+private:
+	static bool constexpr _IS_ITERATIVE = SM == Solving_Mode::LSQR || SM == Solving_Mode::CG;
+
+	class _direct_impl_t;
+	class _iterative_impl_t;
+
+	using _impl_t = Selective_t<_IS_ITERATIVE, _iterative_impl_t, _direct_impl_t>;
+
+	_impl_t _impl;
+
+	using _Default_Flag_Set = Flag_Set<>;
+
+	template<class AMAT>
+	static bool constexpr _is_Design_Matrix_v
+	=	trait::Has_Matrix_interface<AMAT>::value || trait::is_SparseMat<AMAT>::value;
+
+
+public:
+	template
+	<	class AMAT, class FS = _Default_Flag_Set
+	,	class = Enable_if_t< _is_Design_Matrix_v<AMAT> && is_Flag_Set<FS>::value >
+	>
+	Least_Square_Solver(AMAT&& A, FS&& fs = {}){  (*this)( Forward<AMAT>(A), Forward<FS>(fs) );  }
+
+
+	template
+	<	class AMAT, class FS = _Default_Flag_Set
+	,	class = Enable_if_t< _is_Design_Matrix_v<AMAT> && is_Flag_Set<FS>::value >
+	>
+	auto operator()(AMAT&& A, FS&& fs = {})-> Least_Square_Solver&
+	{
+		return _impl( Forward<AMAT>(A), Forward<FS>(fs) ),  *this;
+	}
+
+
+	auto rows() const-> size_t{  return _impl.rows();  }
+	auto cols() const-> size_t{  return _impl.cols();  }
+
+
+	template
+	<	class BMAT, class B_t = Decay_t<BMAT>
+	,	class XMAT = _MatrixAdaptor<T, COLS, B_t::STT_COL_SIZE, Storing_Order::COL_FIRST>
+	>
+	auto solve(BMAT const& B) const-> XMAT
+	{
+		assert( B.rows() == rows() );
+
+		return _impl.solve(B);
+	}
+
+
+	//	The solution with how the iterations went , the worst over the columns of B .
+	template
+	<	class BMAT, class B_t = Decay_t<BMAT>
+	,	class XMAT = _MatrixAdaptor<T, COLS, B_t::STT_COL_SIZE, Storing_Order::COL_FIRST>
+	>
+	auto solve_with_stats(BMAT const& B) const-> std::pair< XMAT, Convergence_Stats<T> >
+	{
+		static_assert(_IS_ITERATIVE, "only iterative solvers have convergence stats .");
+
+		assert( B.rows() == rows() );
+
+		Convergence_Stats<T> stats;
+		XMAT X = _impl.solve(B, stats);
+
+		return {Move(X), stats};
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
 struct s3d::Least_Square_Problem : Unconstructible
 {
 	template
-	<	Solving_Mode SM = Solving_Mode::QR, class AMAT, class BVEC
+	<	Solving_Mode SM = Solving_Mode::QR, class AMAT, class FS = Flag_Set<>
+	,	class A_t = Decay_t<AMAT>
+	,	class RES
+		=	Least_Square_Solver
+			<	trait::value_t<A_t>, A_t::STT_ROW_SIZE, A_t::STT_COL_SIZE, A_t::STORING_ORDER, SM
+			>
+	>
+	static auto solver(AMAT&& A, FS&& fs = {})-> RES
+	{
+		return RES( Forward<AMAT>(A), Forward<FS>(fs) );
+	}
+
+
+	template
+	<	Solving_Mode SM = Solving_Mode::QR, class AMAT, class BVEC, class FS = Flag_Set<>
 	,	class A_t = Decay_t<AMAT>
 	,	class XVEC 
 		=	_MatrixAdaptor
@@ -333,11 +732,11 @@ struct s3d::Least_Square_Problem : Unconstructible
 			,	Storing_Order::COL_FIRST 
 			>
 	>
-	static auto solution(AMAT const& A, BVEC const& b)-> XVEC
+	static auto solution(AMAT const& A, BVEC const& b, FS&& fs = {})-> XVEC
 	{
 		assert( b.cols() == 1 && A.rows() == b.rows() );
 
-		return _Least_Square_Solution_Helper<SM>::calc(A, b);
+		return solver<SM>( A, Forward<FS>(fs) ).solve(b);
 	}
 };
 
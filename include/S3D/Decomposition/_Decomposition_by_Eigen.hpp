@@ -6,6 +6,37 @@
 
 #pragma once
 #include "Eigen/Dense"
+#include <algorithm>
+#include <cmath>
+
+
+namespace s3d
+{
+
+	/**	r x c matrix having the first n elements of diag on its diagonal and zeros elsewhere ,
+	*	evaluated only when read , so that building it takes no heap allocation .
+	*	diag must outlive the result .
+	*/
+	template<size_t ROWS, size_t COLS, Storing_Order STOR, class VEC>
+	static auto _Lazy_Diagmat(VEC const& diag, size_t const n, size_t const r, size_t const c)
+	{
+		using elem_t = Decay_t< decltype(diag(0)) >;
+		using egn_Mat_t = Eigen::Matrix<elem_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+		auto elem_f
+		=	[&diag, n](Eigen::Index const i, Eigen::Index const j)-> elem_t
+			{
+				return i == j && static_cast<size_t>(i) < n ? diag(i) : elem_t(0);
+			};
+
+		return 
+		_Seed_Helper::template lazy<ROWS, COLS, STOR>
+		(	egn_Mat_t::NullaryExpr( static_cast<int>(r), static_cast<int>(c), elem_f )
+		);
+	}
+
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
 template
@@ -28,6 +59,10 @@ private:
 
 	using _Elem_t = typename Decay_t<decltype(_solver.eigenvectors())>::value_type;
 
+	//	Fixed 2x2 and 3x3 real symmetric matrices are solved in closed form without iterations .
+	static bool constexpr _IS_DIRECT 
+	=	IS_REAL_SYMMETRIC && ROWS == COLS && (ROWS == 2 || ROWS == 3);
+
 
 public:
 	template<class MAT, class FS>
@@ -35,13 +70,13 @@ public:
 	{
 		_has_computed_eigenvectors = !Has_Flag<flag::Value_Only, FS>::value;
 
-		if constexpr(IS_REAL_SYMMETRIC)
-			_solver.compute
-			(	_Mat_implementor( Forward<MAT>(m) )
-			,	_has_computed_eigenvectors 
-				?	Eigen::ComputeEigenvectors 
-				:	Eigen::EigenvaluesOnly
-			);
+		int const option
+		=	_has_computed_eigenvectors ? Eigen::ComputeEigenvectors : Eigen::EigenvaluesOnly;
+
+		if constexpr(_IS_DIRECT)
+			_solver.computeDirect( _Mat_implementor( Forward<MAT>(m) ), option );
+		else if constexpr(IS_REAL_SYMMETRIC)
+			_solver.compute( _Mat_implementor( Forward<MAT>(m) ), option );
 		else
 			_solver.compute(  _Mat_implementor( Forward<MAT>(m) ), _has_computed_eigenvectors  );
 	}
@@ -64,15 +99,9 @@ public:
 
 	auto diagmat() const
 	{
-		size_t const dim = _solver.eigenvectors().cols();
-
-		s3d::Matrix<_Elem_t, ROWS, COLS, STOR> res 
-		=	s3d::Matrix<_Elem_t, ROWS, COLS, STOR>::Zero(dim, dim);
-
-		for(size_t i = 0;  i < dim;  ++i)
-			res(i, i) = _solver.eigenvalues()(i);
+		size_t const dim = _solver.eigenvalues().size();
 
-		return res;
+		return _Lazy_Diagmat<ROWS, COLS, STOR>(_solver.eigenvalues(), dim, dim, dim);
 	}
 
 
@@ -89,18 +118,42 @@ private:
 	DynamicMat<T, STOR> _U{}, _V{};
 	Vector<T> _values{};
 
-	using _MA_t = _MatrixAdaptor<T, DYNAMIC, DYNAMIC, STOR>;
+	//	Fixed 2x2 and 3x3 matrices are decomposed on the stack , where thin and full modes coincide .
+	static bool constexpr _IS_FIXED_SQUARE = ROWS == COLS && (ROWS == 2 || ROWS == 3);
+
+	using _Input_t
+	=	Selective_t
+		<	_IS_FIXED_SQUARE
+		,	Eigen::Matrix<T, int(ROWS), int(COLS)>
+		,	Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> 
+		>;
+
+	//	The solver and the input copy are kept as workspaces , so that decomposing matrices of
+	//	the same shape with the same flags again allocates nothing .
+	Eigen::JacobiSVD<_Input_t> _solver{};
+	_Input_t _input{};
+
+	//	Truncation narrows the views on _values , _U and _V only , so their storages are reused .
+	size_t _nof_valid = 0,  _nof_Ucols = 0,  _nof_Vcols = 0;
 
 
 public:
 	template<class MAT, class FS>
 	void operator()(MAT&& m, [[maybe_unused]] FS&& fs)
 	{
-		Eigen::JacobiSVD< Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > const svd
-		(	_Mat_implementor( Forward<MAT>(m) ), _bit_flag<FS>()
-		);
+		unsigned constexpr option = _bit_flag<FS>();
+
+		if constexpr(_IS_FIXED_SQUARE)
+			_solver.compute( _Mat_implementor( Forward<MAT>(m) ), option );
+		else
+			_input = _Mat_implementor( Forward<MAT>(m) ),
+			_solver.compute(_input, option);
+
+		auto const& svd = _solver;
+
+		_Mat_implementor(_values) = svd.singularValues();
 
-		_values = _MA_t(svd.singularValues());
+		_nof_valid = _values.size();
 
 		assert
 		(	s3d::trait::is_Sorted
@@ -116,33 +169,42 @@ public:
 	}
 
 
-	decltype(auto) Umat() const{  return _U;  }
-	decltype(auto) Vmat() const{  return _V;  }
+	auto Umat() const
+	{
+		return 
+		_Seed_Helper::template lazy<DYNAMIC, DYNAMIC, STOR>
+		(	_Mat_implementor(_U).leftCols( _Seed_Helper::index(_nof_Ucols) )
+		);
+	}
+
+	auto Vmat() const
+	{
+		return 
+		_Seed_Helper::template lazy<DYNAMIC, DYNAMIC, STOR>
+		(	_Mat_implementor(_V).leftCols( _Seed_Helper::index(_nof_Vcols) )
+		);
+	}
 	
-	decltype(auto) Ucol(size_t const idx) const{  return Umat().col(idx);  }
-	decltype(auto) Vcol(size_t const idx) const{  return Vmat().col(idx);  }
+	decltype(auto) Ucol(size_t const idx) const{  return assert(idx < _nof_Ucols),  _U.col(idx);  }
+	decltype(auto) Vcol(size_t const idx) const{  return assert(idx < _nof_Vcols),  _V.col(idx);  }
 
-	auto nof_singularvals() const-> size_t{  return _values.size();  }
-	auto singularval(size_t const idx) const-> T{  return _values(idx);  }
+	auto nof_singularvals() const-> size_t{  return _nof_valid;  }
+	auto singularval(size_t const idx) const-> T{  return assert(idx < _nof_valid),  _values(idx);  }
 
 
-	auto diagmat() const-> DynamicMat<T, STOR>
+	auto diagmat() const
 	{
 		bool const is_full_mode
-		=	(	Umat().size() != 0 && Vmat().size() != 0 
-			&&	is_Square_Matrix(Umat()) && is_Square_Matrix(Vmat())
+		=	(	_nof_Ucols != 0 && _nof_Vcols != 0 
+			&&	_nof_Ucols == _U.rows() && _nof_Vcols == _V.rows()
 			);
 
 		size_t const
-			r = is_full_mode ? Umat().cols() : nof_singularvals(),
-			c = is_full_mode ? Vmat().rows() : nof_singularvals();
-
-		DynamicMat<T, STOR> res = DynamicMat<T, STOR>::Zero(r, c);
+			r = is_full_mode ? _nof_Ucols : nof_singularvals(),
+			c = is_full_mode ? _nof_Vcols : nof_singularvals();
 
-		for(size_t i = 0;  i < nof_singularvals();  ++i)
-			res(i, i) = singularval(i);
-
-		return res;
+		return 
+		_Lazy_Diagmat<DYNAMIC, DYNAMIC, STOR>( _Mat_implementor(_values), nof_singularvals(), r, c );
 	}
 
 
@@ -155,7 +217,7 @@ private:
 		else
 		{
 			unsigned constexpr
-				MODE = Has_Flag<flag::FullMat, FS>::value ? 1 : 0,
+				MODE = Has_Flag<flag::FullMat, FS>::value || _IS_FIXED_SQUARE ? 1 : 0,
 				UB 
 				=	Has_Flag<flag::VMat_Only, FS>::value ? 0
 				:	MODE == 1 ? Eigen::ComputeFullU
@@ -177,6 +239,8 @@ private:
 			_clear(_U),  _clear(_V);
 		else
 			m = Decay_t<decltype(m)>{};
+
+		_nof_Ucols = _U.cols(),  _nof_Vcols = _V.cols();
 	}
 
 
@@ -186,68 +250,409 @@ private:
 		if constexpr(Has_Flag<flag::VMat_Only, FS>::value)
 			_clear(_U);
 		else
-			_U = _MA_t(svd.matrixU());
+			_Mat_implementor(_U) = svd.matrixU();
 
 
 		if constexpr(Has_Flag<flag::UMat_Only, FS>::value)
 			_clear(_V);
 		else
-			_V = _MA_t(svd.matrixV());
+			_Mat_implementor(_V) = svd.matrixV();
 
 
+		_nof_Ucols = _U.cols(),  _nof_Vcols = _V.cols();
+
 		if constexpr(Has_Satisfying_Flag<flag::is_Truncated, FS>::value)
-			Satisfying_Flag<flag::is_Truncated>(fs).cut(_values, _U, _V);
+			_nof_valid = Satisfying_Flag<flag::is_Truncated>(fs).nof_valid(_values),
+			_nof_Ucols = std::min(_nof_Ucols, _nof_valid),
+			_nof_Vcols = std::min(_nof_Vcols, _nof_valid);
 	}
 };
-//========//========//========//========//=======#//========//========//========//========//=======#
 
 
-template<>
-class s3d::_Least_Square_Solution_Helper<s3d::Solving_Mode::SVD>
+template<class T, std::size_t DIM>
+class s3d::Symmetric_Eigen_Batch<T, DIM>::_impl_t : Unconstructible
 {
-	friend struct Least_Square_Problem;
+	friend class s3d::Symmetric_Eigen_Batch<T, DIM>;
 
 
-	template<class AMAT, class BVEC>
-	static auto calc(AMAT const& amat, BVEC const& bvec)
+	template<bool WITH_VECTORS>
+	static void calc
+	(	PointSet<T, NOF_ENTRIES> const& mats
+	,	PointSet<T, DIM>& vals, PointSet<T, DIM> (&vecs)[DIM]
+	,	size_t const bi, size_t const ei
+	)
 	{
-		auto& A = _Mat_implementor(amat);
-		auto& b = _Mat_implementor(bvec);
-		
-		return A.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(b).eval();
+		using Mat_t = Eigen::Matrix<T, DIM, DIM>;
+
+		Eigen::SelfAdjointEigenSolver<Mat_t> solver;
+		Mat_t m;
+
+		for(size_t idx = bi;  idx < ei;  ++idx)
+		{
+			for(size_t i = 0, n = 0;  i < DIM;  ++i)
+				for(size_t j = i;  j < DIM;  ++j,  ++n)
+					m(i, j) = m(j, i) = mats(idx, n);
+
+			solver.computeDirect
+			(	m, WITH_VECTORS ? Eigen::ComputeEigenvectors : Eigen::EigenvaluesOnly
+			);
+
+			for(size_t k = 0;  k < DIM;  ++k)
+			{
+				vals(idx, k) = solver.eigenvalues()(k);
+
+				if constexpr(WITH_VECTORS)
+					for(size_t d = 0;  d < DIM;  ++d)
+						vecs[k](idx, d) = solver.eigenvectors()(d, k);
+			}
+		}
 	}
 };
 
 
-template<>
-class s3d::_Least_Square_Solution_Helper<s3d::Solving_Mode::QR>
+template<class T, std::size_t DIM>
+class s3d::Singular_Value_Batch<T, DIM>::_impl_t : Unconstructible
 {
-	friend struct Least_Square_Problem;
+	friend class s3d::Singular_Value_Batch<T, DIM>;
 
 
-	template<class AMAT, class BVEC>
-	static auto calc(AMAT const& amat, BVEC const& bvec)
+	template<bool WITH_U, bool WITH_V>
+	static void calc
+	(	PointSet<T, DIM*DIM> const& mats
+	,	PointSet<T, DIM>& vals, PointSet<T, DIM> (&Us)[DIM], PointSet<T, DIM> (&Vs)[DIM]
+	,	size_t const bi, size_t const ei
+	)
 	{
-		auto& A = _Mat_implementor(amat);
-		auto& b = _Mat_implementor(bvec);
+		using Mat_t = Eigen::Matrix<T, DIM, DIM>;
+
+		unsigned constexpr 
+			OPTION = (WITH_U ? Eigen::ComputeFullU : 0) | (WITH_V ? Eigen::ComputeFullV : 0);
 
-		return A.colPivHouseholderQr().solve(b).eval();
+		Eigen::JacobiSVD<Mat_t> svd;
+		Mat_t m;
+
+		for(size_t idx = bi;  idx < ei;  ++idx)
+		{
+			for(size_t i = 0;  i < DIM;  ++i)
+				for(size_t j = 0;  j < DIM;  ++j)
+					m(i, j) = mats(idx, i*DIM + j);
+
+			svd.compute(m, OPTION);
+
+			for(size_t k = 0;  k < DIM;  ++k)
+			{
+				vals(idx, k) = svd.singularValues()(k);
+
+				for(size_t d = 0;  d < DIM;  ++d)
+				{
+					if constexpr(WITH_U)
+						Us[k](idx, d) = svd.matrixU()(d, k);
+
+					if constexpr(WITH_V)
+						Vs[k](idx, d) = svd.matrixV()(d, k);
+				}
+			}
+		}
 	}
 };
+//========//========//========//========//=======#//========//========//========//========//=======#
 
 
-template<>
-class s3d::_Least_Square_Solution_Helper<s3d::Solving_Mode::CHOLESKY>
+template
+<	class T, std::size_t ROWS, std::size_t COLS, s3d::Storing_Order STOR, s3d::Solving_Mode SM
+>
+class s3d::Least_Square_Solver<T, ROWS, COLS, STOR, SM>::_direct_impl_t
 {
-	friend struct Least_Square_Problem;
+private:
+	using _Mat_t = typename _Seed_Matrix<T, ROWS, COLS, STOR>::egn_Mat_t;
+	using _DynMat_t = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+	using _Normal_t = typename _Seed_Matrix<T, COLS, COLS, STOR>::egn_Mat_t;
+	using _Adjoint_t = typename _Seed_Matrix<T, COLS, ROWS, STOR>::egn_Mat_t;
+
+	//	Eigen::JacobiSVD computes thin U and V only for matrices of dynamic column size .
+	//	A matrix of static sizes is decomposed as it is in full mode instead , where solving 
+	//	reads only the leading columns of U and V , so that nothing is copied to the heap .
+	//	That is only for square or small ones , as full U of a tall one is ROWS x ROWS on the 
+	//	stack , which goes over the stack limit of Eigen soon .
+	static bool constexpr _IS_THIN_SVD_ABLE = COLS == DYNAMIC;
+
+	static size_t constexpr _MAX_FULL_SVD_ROWS = 16;
+	
+	static bool constexpr _IS_FULL_SVD_STATIC
+	=	trait::is_StaticSize<ROWS>::value && trait::is_StaticSize<COLS>::value
+	&&	(ROWS == COLS || ROWS <= _MAX_FULL_SVD_ROWS);
+
+	using _SVD_Mat_t = Selective_t< _IS_THIN_SVD_ABLE || _IS_FULL_SVD_STATIC, _Mat_t, _DynMat_t >;
+
+	using _Factor_t
+	=	Selective_t
+		<	SM == Solving_Mode::QR, Eigen::ColPivHouseholderQR<_Mat_t>
+		,	Selective_t
+			<	SM == Solving_Mode::SVD, Eigen::JacobiSVD<_SVD_Mat_t>
+			,	/* CHOLESKY */ Eigen::LLT<_Normal_t>
+			>
+		>;
+
+	_Factor_t _factor{};
+	Selective_t< SM == Solving_Mode::CHOLESKY, _Adjoint_t, sgm::None > _adjoint{};
+	size_t _rows = 0, _cols = 0;
+
+
+public:
+	template<class AMAT, class FS>
+	void operator()(AMAT const& amat, FS&&)
+	{
+		static_assert
+		(	!trait::is_SparseMat<AMAT>::value
+		,	"a SparseMat is solved only by iterative modes , Solving_Mode::LSQR or Solving_Mode::CG ."
+		);
+
+		auto const& A = _Mat_implementor(amat);
+
+		_rows = A.rows(),  _cols = A.cols();
+
+		if constexpr(SM == Solving_Mode::QR)
+			_factor.compute(A);
+		else if constexpr(SM == Solving_Mode::SVD)
+		{
+			unsigned constexpr option
+			=	_IS_FULL_SVD_STATIC 
+				?	Eigen::ComputeFullU | Eigen::ComputeFullV
+				:	Eigen::ComputeThinU | Eigen::ComputeThinV;
+
+			_factor.compute(A, option);
+		}
+		else if constexpr(SM == Solving_Mode::CHOLESKY)
+			_adjoint = A.adjoint(),
+			_factor.compute(_adjoint*A);
+	}
+
+
+	auto rows() const-> size_t{  return _rows;  }
+	auto cols() const-> size_t{  return _cols;  }
+
+
+	template<class BMAT>
+	auto solve(BMAT const& bmat) const
+	{
+		auto const& B = _Mat_implementor(bmat);
+
+		if constexpr(SM == Solving_Mode::CHOLESKY)
+			return _factor.solve(_adjoint*B).eval();
+		else
+			return _factor.solve(B).eval();
+	}
+};
+
+
+template
+<	class T, std::size_t ROWS, std::size_t COLS, s3d::Storing_Order STOR, s3d::Solving_Mode SM
+>
+class s3d::Least_Square_Solver<T, ROWS, COLS, STOR, SM>::_iterative_impl_t
+{
+	static_assert(trait::is_real<T>::value);
+
 
+private:
+	using _Vec_t = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+	SparseMat<T, STOR> _A{};
+	_Vec_t _scale{};  // Jacobi preconditioner : 1 / |j-th column of A|
+	T _tolerance = std::sqrt( std::numeric_limits<T>::epsilon() );
+	size_t _max_iterations = 0;
+
+
+public:
+	template<class AMAT, class FS>
+	void operator()(AMAT&& amat, FS&& fs)
+	{
+		if constexpr(trait::is_SparseMat<AMAT>::value)
+			_A = Forward<AMAT>(amat);
+		else
+			_A = SparseMat<T, STOR>(amat);
+
+		auto const& A = _SpMat_implementor(_A);
+
+		if constexpr(Has_Flag<flag::Preconditioned, FS>::value)
+		{
+			_scale = A.cwiseAbs2().transpose()*_Vec_t::Ones(A.rows());
+
+			for(Eigen::Index j = 0;  j < _scale.size();  ++j)
+				_scale(j) = _scale(j) > T(0) ? T(1) / std::sqrt( _scale(j) ) : T(1);
+		}
+		else
+			_scale = _Vec_t::Ones(A.cols());
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Tolerance, FS>::value)
+			_tolerance = static_cast<T>( Satisfying_Flag<flag::is_Tolerance>(fs).tolerance );
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Iteration_Cap, FS>::value)
+			_max_iterations = Satisfying_Flag<flag::is_Iteration_Cap>(fs).max_iterations;
+		else
+			_max_iterations = std::max<size_t>(2*cols(), 10);
+	}
+
+
+	auto rows() const-> size_t{  return _A.rows();  }
+	auto cols() const-> size_t{  return _A.cols();  }
+
+	//	total gets the worst of the stats over the columns of bmat .
+	template<class BMAT>
+	auto solve(BMAT const& bmat, Convergence_Stats<T>& total) const
+	{
+		auto const& B = _Mat_implementor(bmat);
+
+		Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> X(cols(), B.cols());
 
-	template<class AMAT, class BVEC>
-	static auto calc(AMAT const& amat, BVEC const& bvec)
+		total = {},  total.converged = true;
+
+		for(size_t j = 0;  j < B.cols();  ++j)
+		{
+			Convergence_Stats<T> stats{};
+
+			X.col( static_cast<Eigen::Index>(j) ) = _solve( B.col(j), stats );
+
+			total.nof_iterations = std::max(total.nof_iterations, stats.nof_iterations);
+			total.residual_norm = std::max(total.residual_norm, stats.residual_norm);
+			total.normal_residual_norm 
+			=	std::max(total.normal_residual_norm, stats.normal_residual_norm);
+			total.converged = total.converged && stats.converged;
+		}
+
+		return X;
+	}
+
+	template<class BMAT>
+	auto solve(BMAT const& bmat) const
 	{
-		auto& A = _Mat_implementor(amat);
-		auto& b = _Mat_implementor(bvec);
+		Convergence_Stats<T> total;
+
+		return solve(bmat, total);
+	}
+
 
-		return (A.adjoint()*A).llt().solve(A.adjoint()*b).eval();
+private:
+	//	products with A D and (A D)^T where D is the diagonal preconditioner
+	auto _AD(_Vec_t const& y) const-> _Vec_t{  return _SpMat_implementor(_A)*_scale.cwiseProduct(y);  }
+	
+	auto _ADt(_Vec_t const& u) const-> _Vec_t
+	{
+		return _scale.cwiseProduct( _SpMat_implementor(_A).transpose()*u );
 	}
-};
\ No newline at end of file
+
+
+	auto _solve(_Vec_t const& b, Convergence_Stats<T>& stats) const-> _Vec_t
+	{
+		_Vec_t y = _Vec_t::Zero(cols());
+
+		if constexpr(SM == Solving_Mode::LSQR)
+			stats.converged = _lsqr(b, y, stats.nof_iterations);
+		else
+			stats.converged = _cgls(b, y, stats.nof_iterations);
+
+		_Vec_t const x = _scale.cwiseProduct(y), r = b - _SpMat_implementor(_A)*x;
+
+		stats.residual_norm = r.norm();
+		stats.normal_residual_norm = ( _SpMat_implementor(_A).transpose()*r ).norm();
+
+		return x;
+	}
+
+
+	//	Paige and Saunders , LSQR : An Algorithm for Sparse Linear Equations and Sparse Least 
+	//	Squares , ACM TOMS 8(1) , 1982 .
+	auto _lsqr(_Vec_t const& b, _Vec_t& y, size_t& nof_iterations) const-> bool
+	{
+		_Vec_t u = b;
+		T beta = u.norm();
+
+		if(beta == T(0))
+			return true;
+
+		u /= beta;
+
+		_Vec_t v = _ADt(u);
+		T alpha = v.norm();
+
+		if(alpha == T(0))
+			return true;
+
+		v /= alpha;
+
+		_Vec_t w = v;
+		T const bnorm = beta;
+		T phibar = beta, rhobar = alpha, anorm_sqr = 0;
+
+		for(size_t itr = 1;  itr <= _max_iterations;  ++itr)
+		{
+			nof_iterations = itr;
+
+			u = _AD(v) - alpha*u,  beta = u.norm();
+
+			if(beta > T(0))
+				u /= beta;
+
+			anorm_sqr += alpha*alpha + beta*beta;
+
+			v = _ADt(u) - beta*v,  alpha = v.norm();
+
+			if(alpha > T(0))
+				v /= alpha;
+
+			T const 
+				rho = std::hypot(rhobar, beta), 
+				c = rhobar/rho, s = beta/rho,
+				theta = s*alpha, phi = c*phibar;
+
+			rhobar = -c*alpha,  phibar = s*phibar;
+
+			y += (phi/rho)*w;
+			w = v - (theta/rho)*w;
+
+			T const rnorm = phibar, arnorm = phibar*alpha*std::abs(c);
+
+			if( rnorm <= _tolerance*bnorm || arnorm <= _tolerance*std::sqrt(anorm_sqr)*rnorm )
+				return true;
+		}
+
+		return false;
+	}
+
+
+	//	conjugate gradient on the normal equations (AD)^T (AD) y = (AD)^T b
+	auto _cgls(_Vec_t const& b, _Vec_t& y, size_t& nof_iterations) const-> bool
+	{
+		_Vec_t r = b, s = _ADt(r), p = s;
+		T gamma = s.squaredNorm();
+		T const s0_norm = std::sqrt(gamma);
+
+		if(s0_norm == T(0))
+			return true;
+
+		for(size_t itr = 1;  itr <= _max_iterations;  ++itr)
+		{
+			nof_iterations = itr;
+
+			_Vec_t const q = _AD(p);
+			T const delta = q.squaredNorm();
+
+			if(delta == T(0))
+				return false;
+
+			T const a = gamma/delta;
+
+			y += a*p,  r -= a*q;
+
+			s = _ADt(r);
+
+			T const gamma_next = s.squaredNorm();
+
+			if( std::sqrt(gamma_next) <= _tolerance*s0_norm )
+				return true;
+
+			p = s + (gamma_next/gamma)*p,  gamma = gamma_next;
+		}
+
+		return false;
+	}
+};
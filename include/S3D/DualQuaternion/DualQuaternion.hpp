@@ -0,0 +1,616 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_DUAL_QUATERNION_
+#define _S3D_DUAL_QUATERNION_
+
+
+#include "S3D/Affine/Affine.hpp"
+#include "S3D/Parallel/Parallel.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+#include "S3D/Quaternion/Quaternion.hpp"
+#include <array>
+#include <vector>
+
+
+namespace s3d
+{
+
+	template<class T>
+	class DualQuaternion;
+
+	template<class T>
+	class UnitDualQuaternion;
+
+
+	struct _Dual_Quaternion_Lanes;
+
+
+	template<class POLICY, class T>
+	static auto compose_all
+	(	POLICY const& policy, PointSet<T, 8> const& lhs, PointSet<T, 8> const& rhs
+	)->	PointSet<T, 8>;
+
+	template<class POLICY, class T, size_t K>
+	static auto blend_all
+	(	POLICY const& policy, PointSet<T, 8> const& udqs
+	,	std::vector< std::array<size_t, K> > const& indices, PointSet<T, K> const& weights
+	)->	PointSet<T, 8>;
+
+	template<class POLICY, class T>
+	static auto transform_all
+	(	POLICY const& policy, PointSet<T, 3>& points, PointSet<T, 8> const& udqs
+	)->	PointSet<T, 3>&;
+
+}
+
+
+namespace s3d::trait
+{
+
+	template<class T>
+	struct is_DualQuaternion;
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	class T
+	,	UnitDualQuaternion, <T>
+	);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+template<class T>
+struct s3d::trait::is_DualQuaternion
+{
+private:
+	template<class Q> /* Declaration Only */
+	static auto _calc(DualQuaternion<Q>) noexcept-> True_t;
+
+	template<class Q> /* Declaration Only */
+	static auto _calc(UnitDualQuaternion<Q>) noexcept-> True_t;
+
+	template<class...> /* Declaration Only */
+	static auto _calc(...) noexcept-> False_t;
+
+
+public:
+	static bool constexpr value = decltype( _calc(Mock<T>()) )::value;
+
+	using type = Boolean<value>;
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Dual quaternion kernels on 8 plain scalars : real w, x, y, z followed by dual w, x, y, z .
+*	A PointSet<T, 8> keeps each of the 8 scalars of many dual quaternions in its own lane ,
+*	so batch kernels below run on packed data without building Quaternion objects .
+*/
+struct s3d::_Dual_Quaternion_Lanes : Unconstructible
+{
+	template<class T>
+	static void compose(T const (&a)[8], T const (&b)[8], T (&res)[8])
+	{
+		for(auto& t : res)
+			t = T(0);
+
+		_qtn_mul_add(a, b, res);
+		_qtn_mul_add(a, b + 4, res + 4);
+		_qtn_mul_add(a + 4, b, res + 4);
+	}
+
+
+	//	Scales the real part to unit norm and removes the component of the dual part along it .
+	template<class T>
+	static void normalize(T (&a)[8])
+	{
+		T const s = T(1) / std::sqrt( _dot(a, a) );
+
+		for(auto& t : a)
+			t *= s;
+
+		T const rd = _dot(a, a + 4);
+
+		for(size_t i = 0;  i < 4;  ++i)
+			a[i + 4] -= rd*a[i];
+	}
+
+
+	template<class T>
+	static void transfer(T const (&a)[8], T const (&p)[3], T (&res)[3])
+	{
+		T const
+			w = a[0], x = a[1], y = a[2], z = a[3],
+			cx = y*p[2] - z*p[1] + w*p[0],
+			cy = z*p[0] - x*p[2] + w*p[1],
+			cz = x*p[1] - y*p[0] + w*p[2];
+
+		//	translation = 2 * vector part of (dual * conjugate of real) .
+		T const
+			tx = T(2)*( -a[4]*x + a[5]*w - a[6]*z + a[7]*y ),
+			ty = T(2)*( -a[4]*y + a[5]*z + a[6]*w - a[7]*x ),
+			tz = T(2)*( -a[4]*z - a[5]*y + a[6]*x + a[7]*w );
+
+		res[0] = p[0] + T(2)*(y*cz - z*cy) + tx;
+		res[1] = p[1] + T(2)*(z*cx - x*cz) + ty;
+		res[2] = p[2] + T(2)*(x*cy - y*cx) + tz;
+	}
+
+
+	template<class T>
+	static auto _dot(T const* p, T const* q)-> T
+	{
+		return p[0]*q[0] + p[1]*q[1] + p[2]*q[2] + p[3]*q[3];
+	}
+
+
+private:
+	template<class T>
+	static void _qtn_mul_add(T const* p, T const* q, T* res)
+	{
+		res[0] += p[0]*q[0] - p[1]*q[1] - p[2]*q[2] - p[3]*q[3];
+		res[1] += p[0]*q[1] + p[1]*q[0] + p[2]*q[3] - p[3]*q[2];
+		res[2] += p[0]*q[2] - p[1]*q[3] + p[2]*q[0] + p[3]*q[1];
+		res[3] += p[0]*q[3] + p[1]*q[2] - p[2]*q[1] + p[3]*q[0];
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+template<class T>
+class s3d::DualQuaternion
+{
+private:
+	using _Qtn = Quaternion<T>;
+
+
+public:
+	static_assert(trait::is_real<T>::value);
+
+	using scalar_type = T;
+
+
+	DualQuaternion(_Qtn const& real = _Qtn(), _Qtn const& dual = _Qtn()) : _real(real), _dual(dual){}
+
+	//	real w, x, y, z followed by dual w, x, y, z .
+	explicit DualQuaternion(Vector<T, 8> const& lanes)
+	:	_real( lanes(0), lanes(1), lanes(2), lanes(3) )
+	,	_dual( lanes(4), lanes(5), lanes(6), lanes(7) ){}
+
+
+	auto real() const-> _Qtn const&{  return _real;  }	auto real()-> _Qtn&{  return _real;  }
+	auto dual() const-> _Qtn const&{  return _dual;  }	auto dual()-> _Qtn&{  return _dual;  }
+
+	auto lanes() const-> Vector<T, 8>
+	{
+		return
+		{	real().w(), real().x(), real().y(), real().z()
+		,	dual().w(), dual().x(), dual().y(), dual().z()
+		};
+	}
+
+
+	auto operator+() const-> DualQuaternion const&{  return *this;  }
+	auto operator-() const{  return DualQuaternion(-real(), -dual());  }
+
+	auto operator+(DualQuaternion const& dq) const
+	{
+		return DualQuaternion(real() + dq.real(), dual() + dq.dual());
+	}
+
+	auto operator-(DualQuaternion const& dq) const{  return *this + (-dq);  }
+
+	auto operator*(DualQuaternion const& dq) const
+	{
+		return DualQuaternion( real()*dq.real(), real()*dq.dual() + dual()*dq.real() );
+	}
+
+	auto operator*(T const s) const{  return DualQuaternion(real()*s, dual()*s);  }
+	auto operator/(T const s) const{  return DualQuaternion(real()/s, dual()/s);  }
+
+	auto operator+=(DualQuaternion const& dq)-> DualQuaternion&{  return *this = *this + dq;  }
+	auto operator-=(DualQuaternion const& dq)-> DualQuaternion&{  return *this = *this - dq;  }
+	auto operator*=(DualQuaternion const& dq)-> DualQuaternion&{  return *this = *this * dq;  }
+	auto operator*=(T const s)-> DualQuaternion&{  return *this = *this * s;  }
+	auto operator/=(T const s)-> DualQuaternion&{  return *this = *this / s;  }
+
+
+	//	Quaternion conjugates of both parts , which inverts a unit dual quaternion .
+	auto conjugate() const{  return DualQuaternion( real().conjugate(), dual().conjugate() );  }
+
+	//	Real part of the dual number norm .
+	auto norm() const-> T{  return real().norm();  }
+
+	auto normalized() const
+	{
+		T a[8];
+
+		_to_lanes(*this, a);
+
+		_Dual_Quaternion_Lanes::normalize(a);
+
+		return _from_lanes(a);
+	}
+
+	auto normalize()-> DualQuaternion&{  return *this = normalized();  }
+
+
+private:
+	template<class>
+	friend class s3d::UnitDualQuaternion;
+
+
+	_Qtn _real, _dual;
+
+
+	static void _to_lanes(DualQuaternion const& dq, T (&a)[8])
+	{
+		a[0] = dq.real().w(),  a[1] = dq.real().x(),  a[2] = dq.real().y(),  a[3] = dq.real().z(),
+		a[4] = dq.dual().w(),  a[5] = dq.dual().x(),  a[6] = dq.dual().y(),  a[7] = dq.dual().z();
+	}
+
+	static auto _from_lanes(T const (&a)[8])-> DualQuaternion
+	{
+		return{ _Qtn(a[0], a[1], a[2], a[3]), _Qtn(a[4], a[5], a[6], a[7]) };
+	}
+};
+
+
+namespace s3d
+{
+
+	template<class T>
+	DualQuaternion(Quaternion<T> const&, Quaternion<T> const&)-> DualQuaternion<T>;
+
+}
+
+
+template<  class S, class T, class = sgm::Enable_if_t< sgm::is_Convertible<S, double>::value >  >
+static auto operator*(S const s, s3d::DualQuaternion<T> const& dq){  return dq*T(s);  }
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Rigid body transform in 3D space as a unit dual quaternion q_r + e*q_d ,
+*	whose real part q_r is the rotation and dual part q_d = t*q_r/2 carries the translation t .
+*	Composition is a single dual quaternion product of 8 scalars and uq1*uq2 applies uq2 first ,
+*	so that rotations and translations of a chain are accumulated without any matrix .
+*/
+template<class T>
+class s3d::UnitDualQuaternion
+{
+private:
+	using _DQtn = DualQuaternion<T>;
+	using _Lanes = _Dual_Quaternion_Lanes;
+
+
+public:
+	static_assert(trait::is_real<T>::value);
+
+	using scalar_type = T;
+
+
+	UnitDualQuaternion() : _dqtn( Quaternion<T>(1) ){}
+
+	UnitDualQuaternion(UnitQuaternion<T> const& rotation, Vector<T, 3> const& translation)
+	:	_dqtn( rotation.qtn(), T(.5)*Quaternion<T>(translation)*rotation.qtn() ){}
+
+	UnitDualQuaternion(Rotation<T, 3> const& rotation)
+	:	UnitDualQuaternion( rotation.cunit_qtn(), Vector<T, 3>::Zero() ){}
+
+	UnitDualQuaternion(Rigid_Body_Transform<T, 3> const& rbtr)
+	:	UnitDualQuaternion( rbtr.rotator().cunit_qtn(), rbtr.vec() ){}
+
+	UnitDualQuaternion(_DQtn const& dq) : _dqtn( dq.normalized() ){}
+
+	explicit UnitDualQuaternion(Vector<T, 8> const& lanes) : UnitDualQuaternion( _DQtn(lanes) ){}
+
+
+	auto dqtn() const-> _DQtn const&{  return _dqtn;  }
+	operator _DQtn const&() const{  return dqtn();  }
+
+	auto real() const-> UnitQuaternion<T>{  return Skipped< UnitQuaternion<T> >(_dqtn.real());  }
+	auto dual() const-> Quaternion<T> const&{  return _dqtn.dual();  }
+	auto lanes() const-> Vector<T, 8>{  return _dqtn.lanes();  }
+
+
+	auto rotation() const-> UnitQuaternion<T>{  return real();  }
+
+	auto translation() const-> Vector<T, 3>
+	{
+		return T(2)*( dual()*_dqtn.real().conjugate() ).v();
+	}
+
+	auto rigid_body_transform() const-> Rigid_Body_Transform<T, 3>
+	{
+		return{ Rotation<T, 3>( rotation() ), translation() };
+	}
+
+	operator Rigid_Body_Transform<T, 3>() const{  return rigid_body_transform();  }
+
+
+	auto operator-() const{  return Skipped<UnitDualQuaternion>(-_dqtn);  }
+	auto operator+() const-> UnitDualQuaternion const&{  return *this;  }
+
+	auto operator*(UnitDualQuaternion const& udq) const-> UnitDualQuaternion
+	{
+		T a[8], b[8], res[8];
+
+		_DQtn::_to_lanes(_dqtn, a),  _DQtn::_to_lanes(udq._dqtn, b);
+
+		_Lanes::compose(a, b, res);
+
+		return Skipped<UnitDualQuaternion>( _DQtn::_from_lanes(res) );
+	}
+
+	auto operator*=(UnitDualQuaternion const& udq)-> UnitDualQuaternion&
+	{
+		return *this = *this * udq;
+	}
+
+
+	auto inv() const{  return conjugate();  }
+	auto conjugate() const{  return Skipped<UnitDualQuaternion>( _dqtn.conjugate() );  }
+
+
+	auto operator()(Vector<T, 3> const& v) const-> Vector<T, 3>
+	{
+		T a[8], p[3] = {v(0), v(1), v(2)}, res[3];
+
+		_DQtn::_to_lanes(_dqtn, a);
+
+		_Lanes::transfer(a, p, res);
+
+		return {res[0], res[1], res[2]};
+	}
+
+
+	/**	Screw linear interpolation : moves along the screw motion from udq0 to udq1 with
+	*	constant speed , rotating and translating at once .
+	*/
+	static auto ScLERP(UnitDualQuaternion const& udq0, UnitDualQuaternion const& udq1, T const t)
+	->	UnitDualQuaternion;
+
+	/**	Dual quaternion linear blending : normalized weighted sum of the dual quaternions ,
+	*	each of which is flipped to the hemisphere of the first one beforehand .
+	*/
+	template<class UCON, class WCON>
+	static auto DLB(UCON const& udqs, WCON const& weights)-> UnitDualQuaternion;
+
+
+private:
+	_DQtn _dqtn;
+
+
+	template<class res_t, class...ARGS, class>
+	friend auto s3d::Skipped(ARGS&&...args) noexcept(Aleph_Check<ARGS&&...>::value);
+
+	template<class...ARGS>
+	UnitDualQuaternion(_ExemptionTag, ARGS&&...args) noexcept(Aleph_Check<ARGS&&...>::value)
+	:	_dqtn( Forward<ARGS>(args)... ){}
+};
+
+
+namespace s3d
+{
+
+	template<class T>
+	UnitDualQuaternion(UnitQuaternion<T> const&, Vector<T, 3> const&)-> UnitDualQuaternion<T>;
+
+	template<class T>
+	UnitDualQuaternion(Rotation<T, 3> const&)-> UnitDualQuaternion<T>;
+
+	template<class T>
+	UnitDualQuaternion(Rigid_Body_Transform<T, 3> const&)-> UnitDualQuaternion<T>;
+
+	template<class T>
+	UnitDualQuaternion(DualQuaternion<T> const&)-> UnitDualQuaternion<T>;
+
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+template<class T>
+auto s3d::UnitDualQuaternion<T>::ScLERP
+(	UnitDualQuaternion const& udq0, UnitDualQuaternion const& udq1, T const t
+)->	UnitDualQuaternion
+{
+	UnitDualQuaternion const
+		diff0 = udq0.inv()*udq1,
+		diff = diff0.real().w() >= 0 ? diff0 : -diff0;
+
+	Quaternion<T> const& r = diff._dqtn.real();
+	Quaternion<T> const& d = diff._dqtn.dual();
+
+	T const
+		half_theta = std::acos(  std::clamp( r.w(), T(-1), T(1) )  ),
+		sh = std::sin(half_theta);
+
+	//	Pure translation has no screw axis , so that the dual part is scaled alone .
+	if( Are_almost_same<T>(sh, 0) )
+		return udq0 * UnitDualQuaternion( _DQtn(Quaternion<T>(1), t*d) );
+
+	Vector<T, 3> const
+		axis = r.v()/sh,
+		moment = ( d.v() - axis*(-d.w()/sh)*r.w() )/sh;
+
+	T const
+		pitch = T(-2)*d.w()/sh*t,
+		ht = half_theta*t,
+		ct = std::cos(ht),  st = std::sin(ht);
+
+	_DQtn const
+		powered
+		(	Quaternion<T>(ct, st*axis)
+		,	Quaternion<T>( -T(.5)*pitch*st, st*moment + T(.5)*pitch*ct*axis )
+		);
+
+	return udq0 * Skipped<UnitDualQuaternion>(powered);
+}
+
+
+template<class T>
+template<class UCON, class WCON>
+auto s3d::UnitDualQuaternion<T>::DLB(UCON const& udqs, WCON const& weights)
+->	UnitDualQuaternion
+{
+	assert( Size(udqs) == Size(weights) && Size(udqs) > 0 );
+
+	T res[8] = {0, 0, 0, 0, 0, 0, 0, 0}, pivot[8];
+
+	_DQtn::_to_lanes( Begin(udqs)->dqtn(), pivot );
+
+	auto witr = Begin(weights);
+
+	for(auto const& udq : udqs)
+	{
+		T a[8];
+
+		_DQtn::_to_lanes(udq.dqtn(), a);
+
+		T const w = _Lanes::_dot(a, pivot) < 0 ? -*witr++ : *witr++;
+
+		for(size_t i = 0;  i < 8;  ++i)
+			res[i] += w*a[i];
+	}
+
+	_Lanes::normalize(res);
+
+	return Skipped<UnitDualQuaternion>( _DQtn::_from_lanes(res) );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+//	res(k) = lhs(k)*rhs(k) for every unit dual quaternion held in 8 lanes .
+template<class POLICY, class T>
+auto s3d::compose_all
+(	POLICY const& policy, PointSet<T, 8> const& lhs, PointSet<T, 8> const& rhs
+)->	PointSet<T, 8>
+{
+	assert( lhs.size() == rhs.size() );
+
+	PointSet<T, 8> res( lhs.size() );
+	T const *L[8], *R[8];
+	T* Res[8];
+
+	for(size_t d = 0;  d < 8;  ++d)
+		L[d] = lhs.lane_data(d),  R[d] = rhs.lane_data(d),  Res[d] = res.lane_data(d);
+
+	Parallel_for
+	(	policy, lhs.size(), sizeof(T)
+	,	[&L, &R, &Res](size_t const bi, size_t const ei)
+		{
+			for(size_t k = bi;  k < ei;  ++k)
+			{
+				T a[8], b[8], c[8];
+
+				_Lane_IO::load(L, k, a),  _Lane_IO::load(R, k, b);
+				_Dual_Quaternion_Lanes::compose(a, b, c);
+				_Lane_IO::store(c, Res, k);
+			}
+		}
+	);
+
+	return res;
+}
+
+
+/**	Dual quaternion linear blending of K influences per item as in linear blend skinning .
+*	The k-th result blends udqs( indices[k][j] ) with weights(k, j) for j < K .
+*/
+template<class POLICY, class T, std::size_t K>
+auto s3d::blend_all
+(	POLICY const& policy, PointSet<T, 8> const& udqs
+,	std::vector< std::array<size_t, K> > const& indices, PointSet<T, K> const& weights
+)->	PointSet<T, 8>
+{
+	assert( indices.size() == weights.size() );
+
+	PointSet<T, 8> res( weights.size() );
+	T const *U[8], *W[K];
+	T* Res[8];
+
+	for(size_t d = 0;  d < 8;  ++d)
+		U[d] = udqs.lane_data(d),  Res[d] = res.lane_data(d);
+
+	for(size_t j = 0;  j < K;  ++j)
+		W[j] = weights.lane_data(j);
+
+	Parallel_for
+	(	policy, weights.size(), sizeof(T)
+	,	[&U, &W, &Res, &indices](size_t const bi, size_t const ei)
+		{
+			for(size_t k = bi;  k < ei;  ++k)
+			{
+				T b[8] = {0, 0, 0, 0, 0, 0, 0, 0}, pivot[8];
+
+				_Lane_IO::load(U, indices[k][0], pivot);
+
+				for(size_t j = 0;  j < K;  ++j)
+				{
+					T a[8];
+
+					_Lane_IO::load(U, indices[k][j], a);
+
+					T const w = _Dual_Quaternion_Lanes::_dot(a, pivot) < 0 ? -W[j][k] : W[j][k];
+
+					for(size_t i = 0;  i < 8;  ++i)
+						b[i] += w*a[i];
+				}
+
+				_Dual_Quaternion_Lanes::normalize(b);
+				_Lane_IO::store(b, Res, k);
+			}
+		}
+	);
+
+	return res;
+}
+
+
+//	Transfers points(k) by the k-th unit dual quaternion of udqs .
+template<class POLICY, class T>
+auto s3d::transform_all
+(	POLICY const& policy, PointSet<T, 3>& points, PointSet<T, 8> const& udqs
+)->	PointSet<T, 3>&
+{
+	assert( points.size() == udqs.size() );
+
+	T const* U[8];
+	T* P[3];
+
+	for(size_t d = 0;  d < 8;  ++d)
+		U[d] = udqs.lane_data(d);
+
+	for(size_t d = 0;  d < 3;  ++d)
+		P[d] = points.lane_data(d);
+
+	Parallel_for
+	(	policy, points.size(), sizeof(T)
+	,	[&U, &P](size_t const bi, size_t const ei)
+		{
+			for(size_t k = bi;  k < ei;  ++k)
+			{
+				T a[8], p[3], res[3];
+
+				_Lane_IO::load(U, k, a);
+
+				for(size_t d = 0;  d < 3;  ++d)
+					p[d] = P[d][k];
+
+				_Dual_Quaternion_Lanes::transfer(a, p, res);
+
+				_Lane_IO::store(res, P, k);
+			}
+		}
+	);
+
+	return points;
+}
+
+
+#endif // end of #ifndef _S3D_DUAL_QUATERNION_
@@ -12,6 +12,12 @@
 #include "S3D/Decomposition/Decomposition.hpp"
 #include "SGM/Container/Array.hpp"
 #include "SGM/Wrapper/Nullable.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 namespace s3d
@@ -27,6 +33,15 @@ namespace s3d
 	template<class T, size_t DIM>  
 	class Line;
 
+	template<class T, size_t DIM>  
+	class Ray;
+
+	template<class T, size_t DIM>  
+	class Segment;
+
+	template<class T, size_t DIM>  
+	class Triangle;
+
 
 	template<class S, class D>  
 	static auto Projection(S&& src, D&& des);
@@ -53,6 +68,44 @@ namespace s3d
 	template<class T>  
 	struct _Position_Helper;
 
+
+	template<class T>
+	struct Neighbor;
+
+	struct _Neighbor_Search;
+
+
+	struct _Euclid_Batch;
+
+	struct _Closest_Approach;
+
+	struct _Ray_Casting;
+
+
+	template<class POLICY, class T, size_t DIM>
+	static void signed_dist_all
+	(	POLICY const& policy, PointSet<T, DIM> const& points, Plane<T, DIM> const& plane
+	,	std::vector<T>& res
+	);
+
+	template<class POLICY, class T, size_t DIM, class PRIM>
+	static void sqrDistance_all
+	(	POLICY const& policy, PointSet<T, DIM> const& points, PRIM const& prim
+	,	std::vector<T>& res
+	);
+
+	template<class POLICY, class T, size_t DIM, class PRIM>
+	static void Projection_all
+	(	POLICY const& policy, PointSet<T, DIM> const& points, PRIM const& prim
+	,	PointSet<T, DIM>& res
+	);
+
+	template<class POLICY, class T, class PRIM>
+	static void ray_cast_all
+	(	POLICY const& policy, Ray<T, 3> const& ray, std::vector<PRIM> const& prims
+	,	std::vector<T>& res
+	);
+
 }
 
 
@@ -77,6 +130,24 @@ namespace s3d::trait
 	);
 
 
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t D)
+	,	Ray, <T, D> 
+	);
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t D)
+	,	Segment, <T, D> 
+	);
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t D)
+	,	Triangle, <T, D> 
+	);
+
+
 	SGM_HAS_MEMBER(DIMENSION);
 
 	
@@ -181,6 +252,106 @@ private:
 };
 
 
+//	Half of a line : the points position() + s tangent() for s >= 0 .
+template<class T, std::size_t DIM>
+class s3d::Ray : public Oriented<T, DIM>
+{
+public:
+	Ray() : _position(Vector<T, DIM>::Zero()), _tangent(){}
+
+	template
+	<	class VEC, class UVEC
+	,	class
+		=	Enable_if_t
+			<	is_Convertible< VEC, Vector<T, DIM> >::value 
+			&&	is_Convertible< UVEC, UnitVec<T, DIM> >::value
+			>
+	>
+	Ray(VEC&& pos, UVEC&& tgt) noexcept(Aleph_Check<VEC&&, UVEC&&>::value)
+	:	_position( Forward<VEC>(pos) ), _tangent( Forward<UVEC>(tgt) ){}
+
+	auto position() const-> Vector<T, DIM> const&{  return _position;  }
+	auto position()-> Vector<T, DIM>&{  return _position;  }
+	auto tangent() const-> UnitVec<T, DIM> const&{  return _tangent;  }
+	auto tangent()-> UnitVec<T, DIM>&{  return _tangent;  }
+
+
+private:
+	Vector<T, DIM> _position;
+	UnitVec<T, DIM> _tangent;	
+};
+
+
+template<class T, std::size_t DIM>
+class s3d::Segment
+{
+public:
+	using value_type = T;
+	static size_t constexpr DIMENSION = DIM;
+	using position_t = Vector<T, DIM>;
+
+	static_assert( trait::is_real<T>::value && DIM > 1 );
+
+
+	Segment() : _source(Vector<T, DIM>::Zero()), _target(Vector<T, DIM>::Zero()){}
+
+	template
+	<	class V1, class V2
+	,	class
+		=	Enable_if_t
+			<	is_Convertible< V1, Vector<T, DIM> >::value 
+			&&	is_Convertible< V2, Vector<T, DIM> >::value
+			>
+	>
+	Segment(V1&& src, V2&& tgt) noexcept(Aleph_Check<V1&&, V2&&>::value)
+	:	_source( Forward<V1>(src) ), _target( Forward<V2>(tgt) ){}
+
+	auto source() const-> Vector<T, DIM> const&{  return _source;  }
+	auto source()-> Vector<T, DIM>&{  return _source;  }
+	auto target() const-> Vector<T, DIM> const&{  return _target;  }
+	auto target()-> Vector<T, DIM>&{  return _target;  }
+
+
+private:
+	Vector<T, DIM> _source, _target;
+};
+
+
+//	Its front side is where (v1 - v0) X (v2 - v0) points to .
+template<class T, std::size_t DIM>
+class s3d::Triangle
+{
+public:
+	using value_type = T;
+	static size_t constexpr DIMENSION = DIM;
+	using position_t = Vector<T, DIM>;
+
+	static_assert( trait::is_real<T>::value && DIM > 1 );
+
+
+	Triangle() : _vertices{Vector<T, DIM>::Zero(), Vector<T, DIM>::Zero(), Vector<T, DIM>::Zero()}{}
+
+	template
+	<	class V0, class V1, class V2
+	,	class
+		=	Enable_if_t
+			<	is_Convertible< V0, Vector<T, DIM> >::value 
+			&&	is_Convertible< V1, Vector<T, DIM> >::value
+			&&	is_Convertible< V2, Vector<T, DIM> >::value
+			>
+	>
+	Triangle(V0&& v0, V1&& v1, V2&& v2) noexcept(Aleph_Check<V0&&, V1&&, V2&&>::value)
+	:	_vertices{ Forward<V0>(v0), Forward<V1>(v1), Forward<V2>(v2) }{}
+
+	auto vertex(size_t const idx) const-> Vector<T, DIM> const&{  return _vertices[idx];  }
+	auto vertex(size_t const idx)-> Vector<T, DIM>&{  return _vertices[idx];  }
+
+
+private:
+	Vector<T, DIM> _vertices[3];
+};
+
+
 namespace s3d
 {
 
@@ -203,6 +374,36 @@ namespace s3d
 	>
 	Line(V&&, U&&)-> Line<S, DIM>;
 
+
+	template
+	<	class V, class U
+	,	class 
+		=	Enable_if_t< trait::is_FixedSizeMat<V>::value && trait::is_FixedSizeMat<U>::value >
+	,	class S = typename Decay_t<V>::value_type
+	,	size_t DIM = trait::Dimension<V>::value
+	>
+	Ray(V&&, U&&)-> Ray<S, DIM>;
+
+
+	template
+	<	class V1, class V2
+	,	class 
+		=	Enable_if_t< trait::is_FixedSizeMat<V1>::value && trait::is_FixedSizeMat<V2>::value >
+	,	class S = typename Decay_t<V1>::value_type
+	,	size_t DIM = trait::Dimension<V1>::value
+	>
+	Segment(V1&&, V2&&)-> Segment<S, DIM>;
+
+
+	template
+	<	class V0, class V1, class V2
+	,	class 
+		=	Enable_if_t< trait::is_FixedSizeMat<V0>::value >
+	,	class S = typename Decay_t<V0>::value_type
+	,	size_t DIM = trait::Dimension<V0>::value
+	>
+	Triangle(V0&&, V1&&, V2&&)-> Triangle<S, DIM>;
+
 }
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
@@ -310,6 +511,159 @@ public:
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+/**	Closest points of two lines or two segments as parameters : s along src and u along des ,
+*	which are lengths along unit tangents for lines and fractions from source to target for
+*	segments .
+*/
+struct s3d::_Closest_Approach : Unconstructible
+{
+	/**	Null when the lines are parallel , where every point has its closest one on the other .
+	*	u solves the problem left after removing the part along src.tangent() , whose terms are
+	*	all normal to it , so that nearly parallel lines keep their precision .
+	*/
+	template<class L1, class L2>
+	static auto lines(L1 const& src, L2 const& des)
+	{
+		using T = typename L1::value_type;
+		using res_t = Nullable< std::pair<T, T> >;
+
+		Vector<T, L1::DIMENSION> const w = src.position() - des.position();
+
+		T const b = src.tangent().dot(des.tangent()),  d = src.tangent().dot(w);
+
+		Vector<T, L1::DIMENSION> const
+			r = w - src.tangent()*d,  n = des.tangent().vec() - src.tangent()*b;
+
+		T const nn = n.sqr_norm();
+
+		if( is_parallel<T>(nn) )
+			return res_t{};
+
+		T const u = n.dot(r)/nn;
+
+		return res_t(  std::pair<T, T>{ b*u - d, u }  );
+	}
+
+
+	//	Ericson , Real-Time Collision Detection 5.1.9 , with degenerate segments being points .
+	template<class T, size_t DIM>
+	static auto segments(Segment<T, DIM> const& src, Segment<T, DIM> const& des)-> std::pair<T, T>
+	{
+		Vector<T, DIM> const
+			d1 = src.target() - src.source(),  d2 = des.target() - des.source(),
+			r = src.source() - des.source();
+
+		T const a = d1.sqr_norm(),  e = d2.sqr_norm(),  f = d2.dot(r);
+
+		if( !(a > 0) && !(e > 0) )
+			return {0, 0};
+		else if( !(a > 0) )
+			return {  T(0), _clamp01(f/e)  };
+
+		T const c = d1.dot(r);
+
+		if( !(e > 0) )
+			return {  _clamp01(-c/a), T(0)  };
+
+		T const b = d1.dot(d2);
+
+		//	d1 and r with their parts along d2 removed , as lines() does .
+		Vector<T, DIM> const m = d1 - d2*(b/e),  rm = r - d2*(f/e);
+		T const mm = m.sqr_norm();
+
+		//	any s will do for parallel segments , as u and then s are clamped again .
+		T s = is_parallel<T>(mm/a) ? T(0) : _clamp01( -m.dot(rm)/mm );
+		T u = (b*s + f)/e;
+
+		if(u < 0)
+			u = 0,  s = _clamp01(-c/a);
+		else if(u > 1)
+			u = 1,  s = _clamp01( (b - c)/a );
+
+		return {s, u};
+	}
+
+
+	/**	For sin^2 of the angle between two directions , or between a direction and a plane .
+	*	Every parameter divided by such a sine is taken as undefined below 100 epsilons .
+	*/
+	template<class T>
+	static auto is_parallel(T const sqr_sine)-> bool
+	{
+		T constexpr min_sine = T(100)*std::numeric_limits<T>::epsilon();
+
+		return !(sqr_sine > min_sine*min_sine);
+	}
+
+
+private:
+	template<class T>
+	static auto _clamp01(T const t)-> T{  return t < 0 ? T(0) : t > 1 ? T(1) : t;  }
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+struct s3d::_Ray_Casting : Unconstructible
+{
+	//	How far along ray it hits plane , or infinity if it does not .
+	template<class T>
+	static auto distance(Ray<T, 3> const& ray, Plane<T, 3> const& plane)-> T
+	{
+		T const den = plane.normal().dot(ray.tangent());
+
+		if( _Closest_Approach::is_parallel<T>(den*den) )
+			return std::numeric_limits<T>::infinity();
+
+		T const s = plane.normal().dot(plane.position() - ray.position())/den;
+
+		return s >= 0 ? s : std::numeric_limits<T>::infinity();
+	}
+
+
+	/**	Moller-Trumbore : solves for the distance and the barycentric coordinates (u, v) of the hit
+	*	at once by Cramer's rule . Edges and vertices count as hits .
+	*/
+	template<class T>
+	static auto distance(Ray<T, 3> const& ray, Triangle<T, 3> const& tri)-> T
+	{
+		T constexpr miss = std::numeric_limits<T>::infinity();
+
+		Vector<T, 3> const
+			e1 = tri.vertex(1) - tri.vertex(0),  e2 = tri.vertex(2) - tri.vertex(0),
+			pv = ray.tangent().vec().cross(e2);
+
+		T const det = e1.dot(pv);
+
+		//	det is the cosine between the ray and the normal times |e1 X e2| . A degenerate 
+		//	triangle gives 0/0 , which is_parallel takes as parallel too .
+		if
+		(	_Closest_Approach::is_parallel<T>
+			(	det*det / Vector<T, 3>( e1.cross(e2) ).sqr_norm()
+			)
+		)
+			return miss;
+
+		T const inv_det = 1/det;
+		Vector<T, 3> const tv = ray.position() - tri.vertex(0);
+		T const u = tv.dot(pv)*inv_det;
+
+		if(u < 0 || u > 1)
+			return miss;
+
+		Vector<T, 3> const qv = tv.cross(e1);
+		T const v = ray.tangent().dot(qv)*inv_det;
+
+		if(v < 0 || u + v > 1)
+			return miss;
+
+		T const s = e2.dot(qv)*inv_det;
+
+		return s >= 0 ? s : miss;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 namespace s3d
 {
 	
@@ -330,6 +684,28 @@ namespace s3d
 			?	Nullable<line_t>( Projection(src.position(), des), tgt )
 			:	Nullable<line_t>{};
 		}
+		else if constexpr(trait::is_Line<S>::value && trait::is_Line<D>::value)
+		{
+			//	the point of des closest to src , null for parallel lines .
+			using pos_t = typename Referenceless_t<D>::position_t;
+
+			auto const su = _Closest_Approach::lines(src, des);
+
+			return
+			su.has_value()
+			?	Nullable<pos_t>( des.position() + des.tangent()*su.v().second )
+			:	Nullable<pos_t>{};
+		}
+		else if constexpr(trait::is_StrictVec<S>::value && trait::is_Segment<D>::value)
+		{
+			using T = typename Referenceless_t<D>::value_type;
+			using pos_t = typename Referenceless_t<D>::position_t;
+
+			pos_t const d = des.target() - des.source();
+			T const dd = d.sqr_norm(),  t = dd > 0 ? d.dot(src - des.source())/dd : T(0);
+
+			return pos_t( des.source() + d*(t < 0 ? T(0) : t > 1 ? T(1) : t) );
+		}
 	}
 	
 	
@@ -342,7 +718,38 @@ namespace s3d
 			return std::pow( des.signed_dist_to(src), 2 );
 		else if constexpr(trait::is_StrictVec<S>::value && trait::is_Line<D>::value)
 			return ( src - Projection(src, des) ).sqr_norm();
-		//else if constexpr(trait::is_Line<S>::value && trait::is_Line_v<D>::value)
+		else if constexpr(trait::is_StrictVec<S>::value && trait::is_Segment<D>::value)
+			return ( src - Projection(src, des) ).sqr_norm();
+		else if constexpr(trait::is_Line<S>::value && trait::is_Line<D>::value)
+		{
+			/**	The part of src.position() - des.position() normal to both tangents . Removing
+			*	the part along des.tangent() - b src.tangent() , rather than solving for the
+			*	closest points , keeps nearly parallel lines from losing precision .
+			*/
+			using T = typename Referenceless_t<S>::value_type;
+			using pos_t = typename Referenceless_t<S>::position_t;
+
+			pos_t r = src.position() - des.position();
+
+			r = r - src.tangent()*src.tangent().dot(r);
+
+			pos_t const n = des.tangent().vec() - src.tangent()*src.tangent().dot(des.tangent());
+
+			//	n of tangents parallel up to rounding errors is all noise and would take off real distance .
+			if( T const nn = n.sqr_norm();  !_Closest_Approach::is_parallel<T>(nn) )
+				r = r - n*(n.dot(r)/nn);
+
+			return r.sqr_norm();
+		}
+		else if constexpr(trait::is_Segment<S>::value && trait::is_Segment<D>::value)
+		{
+			auto const [s, u] = _Closest_Approach::segments(src, des);
+
+			return
+			(	src.source() + (src.target() - src.source())*s
+			-	des.source() - (des.target() - des.source())*u
+			).sqr_norm();
+		}
 	}
 	
 	
@@ -355,7 +762,12 @@ namespace s3d
 			return std::abs( des.signed_dist_to(src) );
 		else if constexpr(trait::is_StrictVec<S>::value && trait::is_Line<D>::value)
 			return ( src - Projection(src, des) ).norm();
-		//else if constexpr(trait::is_Line<S>::value && trait::is_Line_v<D>::value)
+		else if constexpr
+		(	(trait::is_StrictVec<S>::value && trait::is_Segment<D>::value)
+		||	(trait::is_Line<S>::value && trait::is_Line<D>::value)
+		||	(trait::is_Segment<S>::value && trait::is_Segment<D>::value)
+		)
+			return std::sqrt(  sqrDistance( Forward<S>(src), Forward<D>(des) )  );
 	}
 	
 	
@@ -368,7 +780,7 @@ namespace s3d
 	
 			if
 			(	auto const den = des.normal().dot(src.tangent())
-			;	!Are_almost_same< trait::value_t<pos_t>, 2 >(den, 0) 
+			;	!_Closest_Approach::is_parallel< trait::value_t<pos_t> >(den*den) 
 			)
 				return 
 				Nullable<pos_t>
@@ -378,6 +790,21 @@ namespace s3d
 			else
 				return Nullable<pos_t>{};
 		}
+		else if constexpr
+		(	trait::is_Ray<S>::value 
+		&&	(trait::is_Plane<D>::value || trait::is_Triangle<D>::value)
+		)
+		{
+			using pos_t = typename Referenceless_t<S>::position_t;
+
+			if
+			(	auto const s = _Ray_Casting::distance(src, des)
+			;	s < std::numeric_limits< trait::value_t<pos_t> >::infinity()
+			)
+				return Nullable<pos_t>( src.position() + src.tangent()*s );
+			else
+				return Nullable<pos_t>{};
+		}
 	}
 
 
@@ -417,4 +844,447 @@ private:
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+//	An answer of nearest queries : which of the queried primitives and how far in sqrDistance .
+template<class T>
+struct s3d::Neighbor
+{
+	size_t index;
+	T sqr_dist;
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	What nearest queries of spatial trees collect , apart from the traversal . search_f(bound, visit_f)
+*	is a best-first traversal of a tree calling visit_f(index, sqr_dist, bound) on every candidate
+*	whose node has a lower bound no greater than bound , and visit_f may tighten bound .
+*/
+struct s3d::_Neighbor_Search : Unconstructible
+{
+	template<class T, class SEARCH>
+	static auto nearest(SEARCH&& search_f)-> Neighbor<T>
+	{
+		Neighbor<T> res{0, std::numeric_limits<T>::infinity()};
+
+		search_f
+		(	res.sqr_dist
+		,	[&res](size_t const idx, T const sqr_dist, T& bound)
+			{
+				if(sqr_dist < bound)
+					res.index = idx,  bound = sqr_dist;
+			}
+		);
+
+		return res;
+	}
+
+
+	/**	Writes the k nearest candidates to res[0, k) in ascending order , k no greater than the
+	*	number of candidates . res[0, k) is a max heap during the search , whose top bounds it once
+	*	full .
+	*/
+	template<class T, class SEARCH>
+	static void k_nearest(size_t const k, Neighbor<T>* const res, SEARCH&& search_f)
+	{
+		if(k == 0)
+			return;
+
+		size_t nof_found = 0;
+		T bound = std::numeric_limits<T>::infinity();
+
+		search_f
+		(	bound
+		,	[res, k, &nof_found](size_t const idx, T const sqr_dist, T& bound)
+			{
+				if(nof_found < k)
+					res[nof_found++] = {idx, sqr_dist},  std::push_heap(res, res + nof_found, _closer<T>);
+				else if(sqr_dist < res[0].sqr_dist)
+				{
+					std::pop_heap(res, res + k, _closer<T>);
+
+					res[k - 1] = {idx, sqr_dist};
+
+					std::push_heap(res, res + k, _closer<T>);
+				}
+
+				if(nof_found == k)
+					bound = res[0].sqr_dist;
+			}
+		);
+
+		assert(nof_found == k);
+
+		std::sort_heap(res, res + k, _closer<T>);
+	}
+
+
+	//	All candidates no farther than radius in ascending order of sqrDistance .
+	template<class T, class SEARCH>
+	static void within(T const radius, std::vector< Neighbor<T> >& res, SEARCH&& search_f)
+	{
+		res.clear();
+
+		if(radius < 0)
+			return;
+
+		T bound = radius*radius;
+
+		search_f
+		(	bound
+		,	[&res](size_t const idx, T const sqr_dist, T const& bound)
+			{
+				if(sqr_dist <= bound)
+					res.push_back({idx, sqr_dist});
+			}
+		);
+
+		std::sort(res.begin(), res.end(), _closer<T>);
+	}
+
+
+private:
+	template<class T>
+	static auto _closer(Neighbor<T> const& n1, Neighbor<T> const& n2)-> bool
+	{
+		return n1.sqr_dist < n2.sqr_dist;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Kernels over the coordinate lanes of PointSet , where every point reduces to one chain of
+*	multiply-adds with the terms of the primitive computed once beforehand . Points are taken in
+*	blocks whose results go to local arrays first , and the size of full blocks is passed as a
+*	compile time constant : with no aliasing to rule out and a fixed trip count , compilers
+*	vectorize the loops across points .
+*/
+struct s3d::_Euclid_Batch : Unconstructible
+{
+	static size_t constexpr BLOCK_SIZE = 256;
+
+	using Block_Size_t = std::integral_constant<size_t, BLOCK_SIZE>;
+
+
+	/**	Calls f(b, m, lanes) for blocks [b, b + m) of no more than BLOCK_SIZE points , where m is
+	*	Block_Size_t for full blocks and size_t for the last one of a chunk .
+	*/
+	template<class POLICY, class T, size_t DIM, class F>
+	static void for_blocks(POLICY const& policy, PointSet<T, DIM> const& points, F&& f)
+	{
+		T const* lanes[DIM];
+
+		for(size_t d = 0;  d < DIM;  ++d)
+			lanes[d] = points.lane_data(d);
+
+		Parallel_for
+		(	policy, points.size(), sizeof(T)
+		,	[&lanes, &f](size_t const bi, size_t const ei)
+			{
+				size_t b = bi;
+
+				for(;  b + BLOCK_SIZE <= ei;  b += BLOCK_SIZE)
+					f( b, Block_Size_t{}, lanes );
+
+				if(b < ei)
+					f( b, ei - b, lanes );
+			}
+		);
+	}
+
+
+	//	out[k] = c + w . p(b + k) for k < m .
+	template<class T, size_t DIM, class M>
+	static void affine_dot
+	(	T const* const (&lanes)[DIM], size_t const b, M const m, T const (&w)[DIM], T const c
+	,	T (&out)[BLOCK_SIZE]
+	)
+	{
+		for(size_t k = 0;  k < m;  ++k)
+			out[k] = c;
+
+		for(size_t d = 0;  d < DIM;  ++d)
+			for(size_t k = 0;  k < m;  ++k)
+				out[k] += w[d]*lanes[d][b + k];
+	}
+
+
+	//	out[k] = |p(b + k) - x|^2 - ( t . (p(b + k) - x) )^2 for k < m .
+	template<class T, size_t DIM, class M>
+	static void sqr_dist_to_line
+	(	T const* const (&lanes)[DIM], size_t const b, M const m, T const (&x)[DIM]
+	,	T const (&t)[DIM], T (&out)[BLOCK_SIZE]
+	)
+	{
+		T tv[BLOCK_SIZE];
+
+		for(size_t k = 0;  k < m;  ++k)
+			out[k] = tv[k] = 0;
+
+		for(size_t d = 0;  d < DIM;  ++d)
+			for(size_t k = 0;  k < m;  ++k)
+			{
+				T const v = lanes[d][b + k] - x[d];
+
+				out[k] += v*v,  tv[k] += t[d]*v;
+			}
+
+		//	can fall a rounding error below zero otherwise .
+		for(size_t k = 0;  k < m;  ++k)
+		{
+			T const d2 = out[k] - tv[k]*tv[k];
+
+			out[k] = d2 > 0 ? d2 : T(0);
+		}
+	}
+
+
+	/**	( sum of min(d^2, cap) , number of d^2 <= cap ) over the squared distances d^2 of points to
+	*	a plane or a line in 3D . Distances are taken point by point in one pass over the lanes
+	*	and summed up in WIDTH separate accumulators , so that the loop carries no dependency from
+	*	one point to the next and compilers vectorize it .
+	*/
+	template<size_t WIDTH, class T, class PRIM>
+	static auto capped_sqr_dist_sum(PointSet<T, 3> const& points, PRIM const& prim, T const cap)
+	->	std::pair<T, size_t>
+	{
+		T const *const x = points.lane_data(0),  *const y = points.lane_data(1),  *const z = points.lane_data(2);
+		auto const sqr_dist_f = sqr_dist_to(prim);
+		size_t const n = points.size(),  nof_groups = n/WIDTH;
+
+		T sums[WIDTH] = {};
+		std::uint32_t counts[WIDTH] = {};
+
+		for(size_t g = 0;  g < nof_groups;  ++g)
+			for(size_t l = 0;  l < WIDTH;  ++l)
+			{
+				size_t const i = g*WIDTH + l;
+				T const d2 = sqr_dist_f(x[i], y[i], z[i]);
+
+				sums[l] += d2 < cap ? d2 : cap;
+				counts[l] += d2 <= cap ? 1 : 0;
+			}
+
+		for(size_t i = nof_groups*WIDTH;  i < n;  ++i)
+		{
+			T const d2 = sqr_dist_f(x[i], y[i], z[i]);
+
+			sums[0] += d2 < cap ? d2 : cap;
+			counts[0] += d2 <= cap ? 1 : 0;
+		}
+
+		std::pair<T, size_t> res{0, 0};
+
+		for(size_t l = 0;  l < WIDTH;  ++l)
+			res.first += sums[l],  res.second += counts[l];
+
+		return res;
+	}
+
+
+	/**	Squared distance from (x, y, z) to a plane or a line in 3D , with the terms of the primitive
+	*	taken once beforehand . For a line |v|^2 - (t.v)^2 can fall a rounding error below zero .
+	*/
+	template<class PRIM>
+	static auto sqr_dist_to(PRIM const& prim)
+	{
+		using T = trait::value_t<PRIM>;
+
+		static_assert( trait::Dimension<PRIM>::value == 3 );
+
+		T const px = prim.position()(0),  py = prim.position()(1),  pz = prim.position()(2);
+
+		if constexpr(trait::is_Plane<PRIM>::value)
+		{
+			T const nx = prim.normal()(0),  ny = prim.normal()(1),  nz = prim.normal()(2);
+
+			return
+			[=](T const x, T const y, T const z)
+			{
+				T const d = nx*(x - px) + ny*(y - py) + nz*(z - pz);
+
+				return d*d;
+			};
+		}
+		else
+		{
+			static_assert( trait::is_Line<PRIM>::value );
+
+			T const tx = prim.tangent()(0),  ty = prim.tangent()(1),  tz = prim.tangent()(2);
+
+			return
+			[=](T const x, T const y, T const z)
+			{
+				T const vx = x - px,  vy = y - py,  vz = z - pz,  s = tx*vx + ty*vy + tz*vz;
+
+				return vx*vx + vy*vy + vz*vz - s*s;
+			};
+		}
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+//	res[k] = plane.signed_dist_to( points(k) ) .
+template<class POLICY, class T, std::size_t DIM>
+void s3d::signed_dist_all
+(	POLICY const& policy, PointSet<T, DIM> const& points, Plane<T, DIM> const& plane
+,	std::vector<T>& res
+)
+{
+	T w[DIM];
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		w[d] = plane.normal()(d);
+
+	T const c = -plane.normal().dot(plane.position());
+
+	res.resize( points.size() );
+
+	_Euclid_Batch::for_blocks
+	(	policy, points
+	,	[&w, c, &res](size_t const b, auto const m, T const* const (&lanes)[DIM])
+		{
+			T out[_Euclid_Batch::BLOCK_SIZE];
+
+			_Euclid_Batch::affine_dot(lanes, b, m, w, c, out);
+
+			std::copy(out, out + m, res.data() + b);
+		}
+	);
+}
+
+
+//	res[k] = sqrDistance( points(k), prim ) where prim is a Plane or a Line .
+template<class POLICY, class T, std::size_t DIM, class PRIM>
+void s3d::sqrDistance_all
+(	POLICY const& policy, PointSet<T, DIM> const& points, PRIM const& prim, std::vector<T>& res
+)
+{
+	static_assert( trait::is_Plane<PRIM>::value || trait::is_Line<PRIM>::value );
+
+	T w[DIM], x[DIM];
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		x[d] = prim.position()(d);
+
+	if constexpr(trait::is_Plane<PRIM>::value)
+		for(size_t d = 0;  d < DIM;  ++d)
+			w[d] = prim.normal()(d);
+	else
+		for(size_t d = 0;  d < DIM;  ++d)
+			w[d] = prim.tangent()(d);
+
+	T c = 0;
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		c -= w[d]*x[d];
+
+	res.resize( points.size() );
+
+	_Euclid_Batch::for_blocks
+	(	policy, points
+	,	[&w, &x, c, &res](size_t const b, auto const m, T const* const (&lanes)[DIM])
+		{
+			T out[_Euclid_Batch::BLOCK_SIZE];
+
+			if constexpr(trait::is_Plane<PRIM>::value)
+			{
+				_Euclid_Batch::affine_dot(lanes, b, m, w, c, out);
+
+				for(size_t k = 0;  k < m;  ++k)
+					out[k] *= out[k];
+			}
+			else
+				_Euclid_Batch::sqr_dist_to_line(lanes, b, m, x, w, out);
+
+			std::copy(out, out + m, res.data() + b);
+		}
+	);
+}
+
+
+/**	res(k) = Projection( points(k), prim ) where prim is a Plane or a Line .
+*	res may be points itself .
+*/
+template<class POLICY, class T, std::size_t DIM, class PRIM>
+void s3d::Projection_all
+(	POLICY const& policy, PointSet<T, DIM> const& points, PRIM const& prim, PointSet<T, DIM>& res
+)
+{
+	static_assert( trait::is_Plane<PRIM>::value || trait::is_Line<PRIM>::value );
+
+	bool constexpr IS_PLANE = trait::is_Plane<PRIM>::value;
+
+	//	p - n (n.p - n.x) onto a plane , and x - t (t.x) + t (t.p) onto a line .
+	T w[DIM], base[DIM];
+	T wx = 0;
+
+	for(size_t d = 0;  d < DIM;  ++d)
+	{
+		if constexpr(IS_PLANE)
+			w[d] = prim.normal()(d);
+		else
+			w[d] = prim.tangent()(d);
+
+		wx += w[d]*prim.position()(d);
+	}
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		base[d] = prim.position()(d) - w[d]*wx;
+
+	res.resize( points.size() );
+
+	T* res_lanes[DIM];
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		res_lanes[d] = res.lane_data(d);
+
+	_Euclid_Batch::for_blocks
+	(	policy, points
+	,	[&w, &base, wx, &res_lanes](size_t const b, auto const m, T const* const (&lanes)[DIM])
+		{
+			T s[_Euclid_Batch::BLOCK_SIZE],  out[_Euclid_Batch::BLOCK_SIZE];
+
+			_Euclid_Batch::affine_dot( lanes, b, m, w, IS_PLANE ? -wx : T(0), s );
+
+			//	every lane of the block is read before its own results are written .
+			for(size_t d = 0;  d < DIM;  ++d)
+			{
+				if constexpr(IS_PLANE)
+					for(size_t k = 0;  k < m;  ++k)
+						out[k] = lanes[d][b + k] - w[d]*s[k];
+				else
+					for(size_t k = 0;  k < m;  ++k)
+						out[k] = base[d] + w[d]*s[k];
+
+				std::copy(out, out + m, res_lanes[d] + b);
+			}
+		}
+	);
+}
+
+
+/**	res[k] is how far along ray it hits prims[k] , or infinity if it does not , where prims are
+*	Planes or Triangles .
+*/
+template<class POLICY, class T, class PRIM>
+void s3d::ray_cast_all
+(	POLICY const& policy, Ray<T, 3> const& ray, std::vector<PRIM> const& prims, std::vector<T>& res
+)
+{
+	static_assert( trait::is_Plane<PRIM>::value || trait::is_Triangle<PRIM>::value );
+
+	res.resize( prims.size() );
+
+	Parallel_for
+	(	policy, prims.size(), sizeof(T)
+	,	[&ray, &prims, &res](size_t const begin, size_t const end)
+		{
+			for(size_t k = begin;  k < end;  ++k)
+				res[k] = _Ray_Casting::distance(ray, prims[k]);
+		}
+	);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
 #endif // end of #ifndef _S3D_EUCLID_
@@ -119,6 +119,24 @@ namespace s3d
 	class OrthogonalMat;
 
 
+	template
+	<	class T, size_t ROWS = DYNAMIC, size_t COLS = DYNAMIC
+	,	Storing_Order STOR = DefaultStorOrder
+	>
+	class MatrixView;
+
+
+	template<class T, size_t ROWS, size_t COLS>
+	class LiteralMat;
+
+	template<class T, size_t SIZE>
+	using LiteralVec
+	=	Selective_t
+		<	DefaultStorOrder == Storing_Order::COL_FIRST
+		,	LiteralMat<T, SIZE, 1>, LiteralMat<T, 1, SIZE>
+		>;
+
+
 	template<class MAT>
 	static decltype(auto) Eval(MAT&&) noexcept(is_Rvalue_Reference<MAT&&>::value);
 
@@ -188,6 +206,16 @@ namespace s3d
 
 	enum class _ExemptionTag{};
 
+
+	template<class T>
+	struct _Fixed_Kernel;
+
+	template<class T>
+	struct _Fixed_Kernel_Helper;
+
+	template<class T>
+	struct _Literal_Math;
+
 	template<class MAT, int DIREC>  
 	struct _VecSpace_Helper;
 
@@ -238,6 +266,18 @@ namespace s3d::trait
 	,	OrthogonalMat, <T, SIZE, STOR>
 	);
 
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t ROWS, size_t COLS, Storing_Order STOR)
+	,	MatrixView, <T, ROWS, COLS, STOR>
+	);
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t ROWS, size_t COLS)
+	,	LiteralMat, <T, ROWS, COLS>
+	);
+
 }
 
 
@@ -801,8 +841,19 @@ private:
 	friend decltype(auto) s3d::_Mat_implementor(MAT&& m);	
 
 	using _impl_t = _MatrixAdaptor<T, ROWS, COLS, STOR>;
+	using _Kernel = _Fixed_Kernel_Helper<T>;
+
+	template<class>
+	friend struct _Fixed_Kernel_Helper;
+
+	template<class, size_t, size_t>
+	friend class LiteralMat;
 
 	_impl_t _impl;
+
+
+	//	Elements are left uninitialized .
+	Matrix(_ExemptionTag) : _impl(){}
 	
 
 public:
@@ -952,31 +1003,71 @@ public:
 	decltype(auto) operator()(size_t const i, size_t const j) const{  return _impl(i, j);  }
 
 	decltype(auto) operator+() const{  return +_impl;  }
-	decltype(auto) operator-() const{  return -_impl;  }
+
+	decltype(auto) operator-() const
+	{
+		if constexpr(_Kernel::template is_for<Matrix>())
+			return _Kernel::neg(*this);
+		else
+			return -_impl;  
+	}
 
 	template<class Q>  
-	auto operator+(Q&& q) const{  return _impl + _Mat_implementor( Forward<Q>(q) );  }
+	auto operator+(Q&& q) const
+	{
+		if constexpr(_Kernel::template is_for_sum<Matrix, Q>())
+			return _Kernel::add(*this, q);
+		else
+			return _impl + _Mat_implementor( Forward<Q>(q) );  
+	}
 	
 	template<class Q>  
-	auto operator-(Q&& q) const{  return _impl - _Mat_implementor( Forward<Q>(q) );  }
+	auto operator-(Q&& q) const
+	{
+		if constexpr(_Kernel::template is_for_sum<Matrix, Q>())
+			return _Kernel::sub(*this, q);
+		else
+			return _impl - _Mat_implementor( Forward<Q>(q) );  
+	}
 	
 	template<class Q>  
-	auto operator*(Q&& q) const{  return _impl * _Mat_implementor( Forward<Q>(q) );  }
+	auto operator*(Q&& q) const
+	{
+		if constexpr(_Kernel::template is_for_product<Matrix, Q>())
+			return _Kernel::mul(*this, q);
+		else
+			return _impl * _Mat_implementor( Forward<Q>(q) );  
+	}
 
 	template<  class Q, class = Enable_if_t< trait::is_complexible<Q>::value >  >  
 	auto operator/(Q const q) const{  return _impl/q;  }
 
 	template<class Q>  
-	auto operator+=(Q&& q)
-	->	Matrix&{  return _impl += _Mat_implementor( Forward<Q>(q) ),  *this;  }
+	auto operator+=(Q&& q)-> Matrix&
+	{
+		if constexpr(_Kernel::template is_for_sum<Matrix, Q>())
+			return *this = _Kernel::add(*this, q);
+		else
+			return _impl += _Mat_implementor( Forward<Q>(q) ),  *this;  
+	}
 	
 	template<class Q>  
-	auto operator-=(Q&& q)
-	->	Matrix&{  return _impl -= _Mat_implementor( Forward<Q>(q) ),  *this;  }
+	auto operator-=(Q&& q)-> Matrix&
+	{
+		if constexpr(_Kernel::template is_for_sum<Matrix, Q>())
+			return *this = _Kernel::sub(*this, q);
+		else
+			return _impl -= _Mat_implementor( Forward<Q>(q) ),  *this;  
+	}
 	
 	template<class Q>  
-	auto operator*=(Q&& q)
-	->	Matrix&{  return _impl *= _Mat_implementor( Forward<Q>(q) ),  *this;  }
+	auto operator*=(Q&& q)-> Matrix&
+	{
+		if constexpr(_Kernel::template is_for_product<Matrix, Q>() && _is_closed_under<Q>())
+			return *this = _Kernel::mul(*this, q);
+		else
+			return _impl *= _Mat_implementor( Forward<Q>(q) ),  *this;  
+	}
 	
 	template<class Q>  
 	auto operator/=(Q&& q)
@@ -1034,17 +1125,30 @@ public:
 	{
 		assert( is_Square_Matrix(*this) );  
 		
-		return _impl.inv();  
+		//	Eigen inverts 4x4 matrices with SIMD intrinsics , which the adjugate kernel is behind .
+		if constexpr(_Kernel::template is_for<Matrix>() && ROWS == COLS && ROWS <= 3)
+			return _Kernel::inv(*this);
+		else
+			return _impl.inv();  
 	}
 
 
-	auto transpose() const{  return _impl.transpose();  }
+	auto transpose() const
+	{
+		if constexpr(_Kernel::template is_for<Matrix>())
+			return _Kernel::transpose(*this);
+		else
+			return _impl.transpose();  
+	}
 	
 	auto det() const
 	{	
 		assert( is_Square_Matrix(*this) );  
 		
-		return _impl.det();  
+		if constexpr(_Kernel::template is_for<Matrix>() && ROWS == COLS)
+			return _Kernel::det(*this);
+		else
+			return _impl.det();  
 	}
 
 
@@ -1053,8 +1157,21 @@ public:
 	auto normalized() const{  return _impl.normalized();  }
 	decltype(auto) normalize(){  return _impl.normalize();  }
 
-	auto dot(Matrix const& m) const-> T{  return _impl.dot(m._impl);  }
-	auto cross(Matrix const& m) const{  return _impl.cross(m._impl);  }
+	auto dot(Matrix const& m) const-> T
+	{
+		if constexpr(_Kernel::template is_for<Matrix>() && (ROWS == 1 || COLS == 1))
+			return _Kernel::dot(*this, m);
+		else
+			return _impl.dot(m._impl);  
+	}
+
+	auto cross(Matrix const& m) const
+	{
+		if constexpr(_Kernel::template is_for<Matrix>() && ROWS*COLS == 3)
+			return _Kernel::cross(*this, m);
+		else
+			return _impl.cross(m._impl);  
+	}
 
 
 	template
@@ -1067,7 +1184,12 @@ public:
 	{
 		assert( Has_Vector_interface(*this) && cols() == q.cols() && rows() == q.rows() );
 
-		if constexpr(is_Same< Vector<T, VSIZE>, ColVec<T, VSIZE> >::value)
+		if constexpr
+		(	_Kernel::template is_for<Matrix>() && _Kernel::template is_for< Vector<T, VSIZE> >()
+		&&	ROWS*COLS == VSIZE
+		)
+			return _Kernel::dyadic(*this, q);
+		else if constexpr(is_Same< Vector<T, VSIZE>, ColVec<T, VSIZE> >::value)
 			return *this*q.transpose();
 		else if constexpr(is_Same< Vector<T, VSIZE>, RowVec<T, VSIZE> >::value)
 			return this->transpose()*q;
@@ -1077,7 +1199,8 @@ public:
 	}
 	
 
-	auto skew() const-> s3d::Matrix<T, 3, 3>
+	//	3x3 lazy expression , so that it is fused into the expression it takes part in .
+	auto skew() const
 	{
 		static_assert
 		(	!trait::is_FixedSizeMat<Matrix>::value
@@ -1086,14 +1209,29 @@ public:
 		
 		assert( Has_Vector_interface(*this) && size() == 3 );
 
-		T constexpr _0 = T(0);
-		T const x = (*this)(0), y = (*this)(1), z = (*this)(2);
+		if constexpr(_Kernel::template is_for<Matrix>() && ROWS*COLS == 3)
+			return _Kernel::skew(*this);
+		else
+		{
+			T const x = (*this)(0), y = (*this)(1), z = (*this)(2);
 
-		return
-		{	_0, -z, y
-		,	z, _0, -x
-		,	-y, x, _0
-		};
+			return
+			_MatrixAdaptor<T, 3, 3, DefaultStorOrder>::generated
+			(	3, 3
+			,	[x, y, z](size_t const i, size_t const j)-> T
+				{
+					T constexpr _0 = T(0);
+
+					T const elems[]
+					{	_0, -z, y
+					,	z, _0, -x
+					,	-y, x, _0
+					};
+
+					return elems[3*i + j];
+				}
+			);
+		}
 	}
 
 
@@ -1130,6 +1268,17 @@ public:
 
 
 private:
+	//	whether multiplying by Q keeps the size .
+	template<class Q>
+	static bool constexpr _is_closed_under()
+	{
+		if constexpr(trait::is_Matrix< Decay_t<Q> >::value)
+			return Decay_t<Q>::STT_ROW_SIZE == COLS && Decay_t<Q>::STT_COL_SIZE == COLS;
+		else
+			return true;
+	}
+
+
 	template<class CON>	
 	static auto _init_by_iterable(CON&& con, Matrix res = {})-> Matrix
 	{
@@ -1260,29 +1409,26 @@ public:
 	auto normalize()-> UnitVec&{  return *this;  };
 
 
+	//	Built in place on every call : a few stores , with no static guard to check .
 	template<size_t IDX = DYNAMIC>
-	static auto Axis([[maybe_unused]] size_t idx = DYNAMIC)
-	->	Selective_t< trait::is_StaticSize<IDX>::value, UnitVec const&, UnitVec >
+	static auto Axis([[maybe_unused]] size_t idx = DYNAMIC)-> UnitVec
 	{
 		static_assert(trait::is_StaticSize<SIZE>::value);
 
 		if constexpr(trait::is_StaticSize<IDX>::value)
 		{
-			static auto const res 
-			=	[](_Vec v){  return v(IDX) = 1,  Skipped<UnitVec>(v);  }(_Vec::Zero());
+			static_assert(IDX < SIZE);
 
 			assert(idx == IDX || idx == DYNAMIC);
 
-			return res;
+			idx = IDX;
 		}
 		else
-		{
-			_Vec res = _Vec::Zero();
+			assert(idx < SIZE);
 
-			assert(idx != DYNAMIC && idx < IDX);
+		_Vec res = _Vec::Zero();
 
-			return res(idx) = 1,  Skipped<UnitVec>(res);
-		}
+		return res(idx) = 1,  Skipped<UnitVec>(res);
 	}
 
 
@@ -1438,6 +1584,326 @@ private:
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+/**	Elementary functions evaluable in constant expressions , for the constants of LiteralMat and
+*	LiteralQuaternion . They are as accurate as those of <cmath> but much slower at run time .
+*/
+template<class T>
+struct s3d::_Literal_Math : Unconstructible
+{
+	static constexpr auto sqrt(T const t)-> T
+	{
+		if( !(t > 0) || t == std::numeric_limits<T>::infinity() )
+			return t == 0 || t > 0 ? t : NaN<T>;
+
+		//	Newton's steps from above the root decrease until they settle down .
+		for(T x = t > 1 ? t : T(1);  ;)
+		{
+			T const y = (x + t/x)/2;
+
+			if(y >= x)
+				return x;
+
+			x = y;
+		}
+	}
+
+
+	static constexpr auto sin(T const t)-> T{  return _Taylor(t, 1);  }
+	static constexpr auto cos(T const t)-> T{  return _Taylor(t, 0);  }
+
+
+private:
+	//	series of sin ( n0 = 1 ) or cos ( n0 = 0 ) after reducing the argument into [-pi, pi] .
+	static constexpr auto _Taylor(T const t, int const n0)-> T
+	{
+		if( !(t - t == 0) )  // infinity or NaN
+			return NaN<T>;
+
+		long double r = t;
+
+		//	A pass loses nothing while the multiple of 2 pi taken is below 2^32 or so . Beyond , 
+		//	t is coarser than 2 pi itself , and further passes only bring what is left into range .
+		while( !(r <= 4 && r >= -4) )
+			r = _reduced(r);
+
+		long double sum = 0,  term = n0 == 0 ? 1 : r;
+
+		for(int n = n0;  sum + term != sum;  n += 2)
+			sum += term,  term *= -r*r/( (n + 1)*(n + 2) );
+
+		return static_cast<T>(sum);
+	}
+
+
+	/**	x - 2 pi k with k the integer nearest to x / 2 pi , computed in floating point only .
+	*	2 pi is split as Cody and Waite do into 32 leading bits , whose multiples by k are exact ,
+	*	and the rest .
+	*/
+	static constexpr auto _reduced(long double const x)-> long double
+	{
+		long double constexpr
+			two_pi = 6.28318530717958647692528676655900577L,
+			two_pi_hi = 6.2831853069365024566650390625L,  // 3373259426 / 2^29
+			two_pi_lo = 2.43084020260247704059005768394338799e-10L;
+
+		long double const k = _nearest_integer(x/two_pi);
+
+		return (x - k*two_pi_hi) - k*two_pi_lo;
+	}
+
+
+	//	Adding and taking back 2^(M - 1) for M mantissa bits rounds x to an integer .
+	static constexpr auto _nearest_integer(long double const x)-> long double
+	{
+		long double big = 1;
+
+		for(int i = 1;  i < std::numeric_limits<long double>::digits;  ++i)
+			big *= 2;
+
+		if( !(x < big && x > -big) )  // already an integer
+			return x;
+
+		return x < 0 ? (x - big) + big : (x + big) - big;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Fixed-size Matrix of a literal type , built and computed in constant expressions .
+*	Eigen storage has no constexpr constructor , so Matrix itself cannot be . LiteralMat holds its
+*	elements in ROW_FIRST order by a plain array and computes by the constexpr kernels , so that
+*	a constexpr LiteralMat is baked into the binary with nothing to initialize at run time .
+*	It converts into Matrix of either storing order , and thereby into UnitVec or OrthogonalMat ,
+*	by copying the elements .
+*/
+template<class T, std::size_t ROWS, std::size_t COLS>
+class s3d::LiteralMat
+{
+public:
+	static_assert(trait::is_real<T>::value);
+	static_assert(trait::is_StaticSize<ROWS>::value && trait::is_StaticSize<COLS>::value);
+
+
+private:
+	using _Kernel = _Fixed_Kernel<T>;
+
+	static size_t constexpr _SIZE = ROWS*COLS;
+	static bool constexpr _IS_VECTOR = ROWS == 1 || COLS == 1;
+
+	T _elems[_SIZE];
+
+
+public:
+	using value_type = T;
+	static size_t constexpr STT_ROW_SIZE = ROWS, STT_COL_SIZE = COLS;
+
+
+	constexpr LiteralMat() : _elems{}{}
+
+	template
+	<	class...ARGS
+	,	class = Enable_if_t< sizeof...(ARGS) == _SIZE && (trait::is_real<ARGS>::value && ...) >
+	>
+	constexpr LiteralMat(ARGS const...args) : _elems{ static_cast<T>(args)... }{}
+
+
+	static constexpr auto Zero()-> LiteralMat{  return {};  }
+
+	static constexpr auto identity()-> LiteralMat
+	{
+		static_assert(ROWS == COLS);
+
+		LiteralMat res;
+
+		for(size_t i = 0;  i < ROWS;  ++i)
+			res(i, i) = 1;
+
+		return res;
+	}
+
+	template<size_t IDX>
+	static constexpr auto Axis()-> LiteralMat
+	{
+		static_assert(_IS_VECTOR && IDX < _SIZE);
+
+		LiteralMat res;
+
+		return res._elems[IDX] = 1,  res;
+	}
+
+
+	template<Storing_Order STOR>
+	operator Matrix<T, ROWS, COLS, STOR>() const
+	{
+		Matrix<T, ROWS, COLS, STOR> res(_ExemptionTag{});
+
+		if constexpr(STOR == Storing_Order::ROW_FIRST || _IS_VECTOR)
+			for(size_t i = 0;  i < _SIZE;  ++i)
+				res.data()[i] = _elems[i];
+		else
+			_Kernel::template transpose<ROWS, COLS>( _elems, res.data() );
+
+		return res;
+	}
+
+
+	static constexpr auto rows()-> size_t{  return ROWS;  }
+	static constexpr auto cols()-> size_t{  return COLS;  }
+	static constexpr auto size()-> size_t{  return _SIZE;  }
+
+	constexpr auto cdata() const-> T const*{  return _elems;  }
+	constexpr auto data() const-> T const*{  return cdata();  }
+	constexpr auto data()-> T*{  return _elems;  }
+
+	constexpr auto operator()(size_t const idx) const-> T{  return assert(idx < _SIZE),  _elems[idx];  }
+	constexpr auto operator()(size_t const idx)-> T&{  return assert(idx < _SIZE),  _elems[idx];  }
+
+	constexpr auto operator()(size_t const i, size_t const j) const-> T
+	{
+		return assert(i < ROWS && j < COLS),  _elems[i*COLS + j];
+	}
+
+	constexpr auto operator()(size_t const i, size_t const j)-> T&
+	{
+		return assert(i < ROWS && j < COLS),  _elems[i*COLS + j];
+	}
+
+
+	constexpr auto operator+() const-> LiteralMat{  return *this;  }
+
+	constexpr auto operator-() const-> LiteralMat
+	{
+		LiteralMat res;
+
+		return _Kernel::template neg<_SIZE>(_elems, res._elems),  res;
+	}
+
+	constexpr auto operator+(LiteralMat const& m) const-> LiteralMat
+	{
+		LiteralMat res;
+
+		return _Kernel::template add<_SIZE>(_elems, m._elems, res._elems),  res;
+	}
+
+	constexpr auto operator-(LiteralMat const& m) const-> LiteralMat
+	{
+		LiteralMat res;
+
+		return _Kernel::template sub<_SIZE>(_elems, m._elems, res._elems),  res;
+	}
+
+	constexpr auto operator*(T const s) const-> LiteralMat
+	{
+		LiteralMat res;
+
+		return _Kernel::template scale<_SIZE>(_elems, s, res._elems),  res;
+	}
+
+	template<size_t C>
+	constexpr auto operator*(LiteralMat<T, COLS, C> const& m) const-> LiteralMat<T, ROWS, C>
+	{
+		LiteralMat<T, ROWS, C> res;
+
+		return _Kernel::template mul<ROWS, COLS, C>( _elems, m.data(), res.data() ),  res;
+	}
+
+	constexpr auto operator/(T const s) const-> LiteralMat
+	{
+		LiteralMat res;
+
+		for(size_t i = 0;  i < _SIZE;  ++i)
+			res._elems[i] = _elems[i]/s;
+
+		return res;
+	}
+
+	constexpr auto operator+=(LiteralMat const& m)-> LiteralMat&{  return *this = *this + m;  }
+	constexpr auto operator-=(LiteralMat const& m)-> LiteralMat&{  return *this = *this - m;  }
+	constexpr auto operator*=(T const s)-> LiteralMat&{  return *this = *this * s;  }
+	constexpr auto operator/=(T const s)-> LiteralMat&{  return *this = *this / s;  }
+
+
+	constexpr auto transpose() const-> LiteralMat<T, COLS, ROWS>
+	{
+		LiteralMat<T, COLS, ROWS> res;
+
+		return _Kernel::template transpose<ROWS, COLS>( _elems, res.data() ),  res;
+	}
+
+	constexpr auto det() const-> T
+	{
+		static_assert(ROWS == COLS && ROWS <= 4);
+
+		if constexpr(ROWS == 1)
+			return _elems[0];
+		else
+			return _Kernel::template det<ROWS>(_elems);
+	}
+
+	constexpr auto inv() const-> LiteralMat
+	{
+		static_assert(ROWS == COLS && ROWS <= 4);
+
+		LiteralMat res;
+
+		if constexpr(ROWS == 1)
+			res._elems[0] = 1/_elems[0];
+		else
+			_Kernel::template inv<ROWS>(_elems, res._elems);
+
+		return res;
+	}
+
+	constexpr auto sqr_norm() const-> T{  return _Kernel::template dot<_SIZE>(_elems, _elems);  }
+	constexpr auto norm() const-> T{  return _Literal_Math<T>::sqrt( sqr_norm() );  }
+	constexpr auto normalized() const-> LiteralMat{  return *this / norm();  }
+	constexpr auto normalize()-> LiteralMat&{  return *this = normalized();  }
+
+	constexpr auto dot(LiteralMat const& m) const-> T
+	{
+		static_assert(_IS_VECTOR);
+
+		return _Kernel::template dot<_SIZE>(_elems, m._elems);
+	}
+
+	constexpr auto cross(LiteralMat const& m) const-> LiteralMat
+	{
+		static_assert(_IS_VECTOR && _SIZE == 3);
+
+		LiteralMat res;
+
+		return _Kernel::cross(_elems, m._elems, res._elems),  res;
+	}
+
+	constexpr auto skew() const-> LiteralMat<T, 3, 3>
+	{
+		static_assert(_IS_VECTOR && _SIZE == 3);
+
+		LiteralMat<T, 3, 3> res;
+
+		return _Kernel::skew( _elems, res.data() ),  res;
+	}
+
+	template<size_t R, size_t C>
+	constexpr auto dyadic(LiteralMat<T, R, C> const& m) const-> LiteralMat<T, _SIZE, R*C>
+	{
+		static_assert(_IS_VECTOR && (R == 1 || C == 1));
+
+		LiteralMat<T, _SIZE, R*C> res;
+
+		return _Kernel::template dyadic<_SIZE, R*C>( _elems, m.data(), res.data() ),  res;
+	}
+};
+
+
+template
+<	class S, class T, std::size_t ROWS, std::size_t COLS
+,	class = sgm::Enable_if_t< s3d::trait::is_real<S>::value >
+>
+static constexpr auto operator*(S const s, s3d::LiteralMat<T, ROWS, COLS> const& m){  return m*T(s);  }
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 namespace s3d
 {
 
@@ -1499,6 +1965,7 @@ private:
 
 
 #include "_Hamilton_by_Eigen.hpp"
+#include "_Hamilton_Fixed_Kernel.hpp"
 
 
 #endif // end of #ifndef _S3D_HAMILTON_
\ No newline at end of file
@@ -0,0 +1,515 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+
+/**	Fully unrolled kernels for Matrices of static sizes up to 4x4 .
+*	With S3D_FIXED_SIZE_KERNELS defined ( CMake option of the same name ) , Matrix operations on
+*	such sizes are done by these kernels instead of Eigen expressions . Results are the same up
+*	to rounding but are evaluated Matrices rather than lazy expressions .
+*/
+
+
+/**	Kernels over arrays holding R x C elements in ROW_FIRST order . All of them are constexpr .
+*	Every kernel reads all of its inputs before writing any result , which lets res alias them
+*	and lets the compiler pack the arithmetic into SIMD registers .
+*/
+template<class T>
+struct s3d::_Fixed_Kernel : Unconstructible
+{
+	template<size_t N>
+	static constexpr void add(T const* a, T const* b, T* res){  _add(a, b, res, _Seq<N>{});  }
+
+	template<size_t N>
+	static constexpr void sub(T const* a, T const* b, T* res){  _sub(a, b, res, _Seq<N>{});  }
+
+	template<size_t N>
+	static constexpr void neg(T const* a, T* res){  _neg(a, res, _Seq<N>{});  }
+
+	template<size_t N>
+	static constexpr void scale(T const* a, T const s, T* res){  _scale(a, s, res, _Seq<N>{});  }
+
+	template<size_t N>
+	static constexpr auto dot(T const* a, T const* b)-> T{  return _dot(a, b, _Seq<N>{});  }
+
+
+	template<size_t R, size_t K, size_t C>
+	static constexpr void mul(T const* a, T const* b, T* res)
+	{
+		_mul<K, C>( a, b, res, _Seq<R*C>{} );
+	}
+
+
+	template<size_t R, size_t C>
+	static constexpr void transpose(T const* a, T* res){  _transpose<R, C>( a, res, _Seq<R*C>{} );  }
+
+
+	//	res = u v^T
+	template<size_t R, size_t C>
+	static constexpr void dyadic(T const* u, T const* v, T* res)
+	{
+		_dyadic<C>( u, v, res, _Seq<R*C>{} );
+	}
+
+
+	static constexpr void cross(T const* a, T const* b, T* res)
+	{
+		T const x[3] = {a[1]*b[2] - a[2]*b[1], a[2]*b[0] - a[0]*b[2], a[0]*b[1] - a[1]*b[0]};
+
+		_store(x, res, _Seq<3>{});
+	}
+
+
+	static constexpr void skew(T const* a, T* res)
+	{
+		T const x[9] = {0, -a[2], a[1],  a[2], 0, -a[0],  -a[1], a[0], 0};
+
+		_store(x, res, _Seq<9>{});
+	}
+
+
+	template<size_t N>
+	static constexpr auto det(T const* a)-> T
+	{
+		static_assert(2 <= N && N <= 4);
+
+		if constexpr(N == 2)
+			return a[0]*a[3] - a[1]*a[2];
+		else if constexpr(N == 3)
+			return
+			(	a[0]*(a[4]*a[8] - a[5]*a[7])
+			-	a[1]*(a[3]*a[8] - a[5]*a[6])
+			+	a[2]*(a[3]*a[7] - a[4]*a[6])
+			);
+		else
+		{
+			T s[6] = {},  c[6] = {};
+
+			_minors(a, s, c);
+
+			return s[0]*c[5] - s[1]*c[4] + s[2]*c[3] + s[3]*c[2] - s[4]*c[1] + s[5]*c[0];
+		}
+	}
+
+
+	//	by adjugates , so a singular matrix gives infinities or NaNs as Eigen does .
+	template<size_t N>
+	static constexpr void inv(T const* a, T* res)
+	{
+		static_assert(2 <= N && N <= 4);
+
+		if constexpr(N == 2)
+		{
+			T const adj[4] = {a[3], -a[1],  -a[2], a[0]};
+
+			_scale( adj, 1/det<2>(a), res, _Seq<4>{} );
+		}
+		else if constexpr(N == 3)
+		{
+			T const adj[9]
+			=	{	a[4]*a[8] - a[5]*a[7],  a[2]*a[7] - a[1]*a[8],  a[1]*a[5] - a[2]*a[4]
+				,	a[5]*a[6] - a[3]*a[8],  a[0]*a[8] - a[2]*a[6],  a[2]*a[3] - a[0]*a[5]
+				,	a[3]*a[7] - a[4]*a[6],  a[1]*a[6] - a[0]*a[7],  a[0]*a[4] - a[1]*a[3]
+				};
+
+			_scale( adj, 1/(a[0]*adj[0] + a[1]*adj[3] + a[2]*adj[6]), res, _Seq<9>{} );
+		}
+		else
+		{
+			T s[6] = {},  c[6] = {};
+
+			_minors(a, s, c);
+
+			T const adj[16]
+			=	{	a[5]*c[5] - a[6]*c[4] + a[7]*c[3]
+				,	-a[1]*c[5] + a[2]*c[4] - a[3]*c[3]
+				,	a[13]*s[5] - a[14]*s[4] + a[15]*s[3]
+				,	-a[9]*s[5] + a[10]*s[4] - a[11]*s[3]
+
+				,	-a[4]*c[5] + a[6]*c[2] - a[7]*c[1]
+				,	a[0]*c[5] - a[2]*c[2] + a[3]*c[1]
+				,	-a[12]*s[5] + a[14]*s[2] - a[15]*s[1]
+				,	a[8]*s[5] - a[10]*s[2] + a[11]*s[1]
+
+				,	a[4]*c[4] - a[5]*c[2] + a[7]*c[0]
+				,	-a[0]*c[4] + a[1]*c[2] - a[3]*c[0]
+				,	a[12]*s[4] - a[13]*s[2] + a[15]*s[0]
+				,	-a[8]*s[4] + a[9]*s[2] - a[11]*s[0]
+
+				,	-a[4]*c[3] + a[5]*c[1] - a[6]*c[0]
+				,	a[0]*c[3] - a[1]*c[1] + a[2]*c[0]
+				,	-a[12]*s[3] + a[13]*s[1] - a[14]*s[0]
+				,	a[8]*s[3] - a[9]*s[1] + a[10]*s[0]
+				};
+
+			_scale
+			(	adj, 1/(s[0]*c[5] - s[1]*c[4] + s[2]*c[3] + s[3]*c[2] - s[4]*c[1] + s[5]*c[0])
+			,	res, _Seq<16>{}
+			);
+		}
+	}
+
+
+private:
+	template<size_t N>
+	using _Seq = std::make_index_sequence<N>;
+
+
+	template<size_t...I>
+	static constexpr void _store(T const* x, T* res, std::index_sequence<I...>)
+	{
+		( (res[I] = x[I]), ... );
+	}
+
+
+	template<size_t...I>
+	static constexpr void _add(T const* a, T const* b, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {(a[I] + b[I])...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+	template<size_t...I>
+	static constexpr void _sub(T const* a, T const* b, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {(a[I] - b[I])...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+	template<size_t...I>
+	static constexpr void _neg(T const* a, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {(-a[I])...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+	template<size_t...I>
+	static constexpr void _scale(T const* a, T const s, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {(a[I]*s)...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+	template<size_t...I>
+	static constexpr auto _dot(T const* a, T const* b, std::index_sequence<I...>)-> T
+	{
+		return ( (a[I]*b[I]) + ... );
+	}
+
+
+	template<size_t K, size_t C, size_t I, size_t...k>
+	static constexpr auto _row_col(T const* a, T const* b, std::index_sequence<k...>)-> T
+	{
+		return ( (a[I/C*K + k]*b[k*C + I%C]) + ... );
+	}
+
+	template<size_t K, size_t C, size_t...I>
+	static constexpr void _mul(T const* a, T const* b, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {_row_col<K, C, I>(a, b, _Seq<K>{})...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+
+	//	res[i] = a[i%R*C + i/R] for the ROW_FIRST C x R result .
+	template<size_t R, size_t C, size_t...I>
+	static constexpr void _transpose(T const* a, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {a[I%R*C + I/R]...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+
+	template<size_t C, size_t...I>
+	static constexpr void _dyadic(T const* u, T const* v, T* res, std::index_sequence<I...>)
+	{
+		T const x[] = {(u[I/C]*v[I%C])...};
+
+		_store( x, res, std::index_sequence<I...>{} );
+	}
+
+
+	//	2x2 minors of the upper two rows ( s ) and of the lower two rows ( c ) of a 4x4 matrix .
+	static constexpr void _minors(T const* a, T* s, T* c)
+	{
+		s[0] = a[0]*a[5] - a[4]*a[1],	s[1] = a[0]*a[6] - a[4]*a[2],	s[2] = a[0]*a[7] - a[4]*a[3];
+		s[3] = a[1]*a[6] - a[5]*a[2],	s[4] = a[1]*a[7] - a[5]*a[3],	s[5] = a[2]*a[7] - a[6]*a[3];
+
+		c[0] = a[8]*a[13] - a[12]*a[9],		c[1] = a[8]*a[14] - a[12]*a[10];
+		c[2] = a[8]*a[15] - a[12]*a[11],	c[3] = a[9]*a[14] - a[13]*a[10];
+		c[4] = a[9]*a[15] - a[13]*a[11],	c[5] = a[10]*a[15] - a[14]*a[11];
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Applies _Fixed_Kernel on Matrices .
+*	A COL_FIRST buffer of a matrix reads as the ROW_FIRST buffer of its transpose , and a vector
+*	reads the same in both orders , so every operation is one of the kernels on the buffers as
+*	they are .
+*/
+template<class T>
+struct s3d::_Fixed_Kernel_Helper : Unconstructible
+{
+private:
+	template<class M>
+	using _Sum_t
+	=	Matrix<T, M::STT_ROW_SIZE, M::STT_COL_SIZE, M::STORING_ORDER>;
+
+
+	template<class M>
+	static size_t constexpr _size(){  return M::STT_ROW_SIZE*M::STT_COL_SIZE;  }
+
+
+	template<class M>
+	static bool constexpr _is_small()
+	{
+		size_t constexpr R = M::STT_ROW_SIZE,  C = M::STT_COL_SIZE;
+
+		return R <= 4 && C <= 4 && R*C >= 2;
+	}
+
+
+	template<class M>
+	static bool constexpr _is_vector(){  return M::STT_ROW_SIZE == 1 || M::STT_COL_SIZE == 1;  }
+
+
+	template<class M, class Q>
+	static bool constexpr _order_agrees()
+	{
+		return _is_vector<M>() || _is_vector<Q>() || M::STORING_ORDER == Q::STORING_ORDER;
+	}
+
+
+	//	vectors take the default order as the Eigen expressions do .
+	template<size_t R, size_t C, Storing_Order STOR>
+	static Storing_Order constexpr _order_of()
+	{
+		return R == 1 || C == 1 ? DefaultStorOrder : STOR;
+	}
+
+
+	//	the order in which the buffers of m , q and m q are all read .
+	template<class M, class Q>
+	static Storing_Order constexpr _product_order()
+	{
+		if constexpr(!_is_vector<M>())
+			return M::STORING_ORDER;
+		else if constexpr(!_is_vector<Q>())
+			return Q::STORING_ORDER;
+		else
+			return DefaultStorOrder;
+	}
+
+
+public:
+#ifdef S3D_FIXED_SIZE_KERNELS
+	static bool constexpr ENABLED = true;
+#else
+	static bool constexpr ENABLED = false;
+#endif
+
+
+	//	whether the kernels take over unary operations on M .
+	template<class M>
+	static bool constexpr is_for()
+	{
+		using _M = Decay_t<M>;
+
+		if constexpr(ENABLED && std::is_floating_point_v<T> && trait::is_Matrix<_M>::value)
+			return _is_small<_M>() && is_Same<typename _M::value_type, T>::value;
+		else
+			return false;
+	}
+
+
+	template<class M, class Q>
+	static bool constexpr is_for_sum()
+	{
+		using _M = Decay_t<M>;  using _Q = Decay_t<Q>;
+
+		if constexpr(is_for<_M>() && is_for<_Q>())
+			return
+			_M::STT_ROW_SIZE == _Q::STT_ROW_SIZE && _M::STT_COL_SIZE == _Q::STT_COL_SIZE
+			&&	_order_agrees<_M, _Q>();
+		else
+			return false;
+	}
+
+
+	template<class M, class Q>
+	static bool constexpr is_for_product()
+	{
+		using _M = Decay_t<M>;  using _Q = Decay_t<Q>;
+
+		if constexpr(is_Same<_Q, T>::value)
+			return is_for<_M>();
+		else if constexpr(is_for<_M>() && is_for<_Q>())
+			return _M::STT_COL_SIZE == _Q::STT_ROW_SIZE && _order_agrees<_M, _Q>();
+		else
+			return false;
+	}
+
+
+	template<class M, class Q>
+	static auto add(M const& m, Q const& q)-> _Sum_t<M>
+	{
+		_Sum_t<M> res(_ExemptionTag{});
+
+		_Fixed_Kernel<T>::template add< _size<M>() >( m.data(), q.data(), res.data() );
+
+		return res;
+	}
+
+
+	template<class M, class Q>
+	static auto sub(M const& m, Q const& q)-> _Sum_t<M>
+	{
+		_Sum_t<M> res(_ExemptionTag{});
+
+		_Fixed_Kernel<T>::template sub< _size<M>() >( m.data(), q.data(), res.data() );
+
+		return res;
+	}
+
+
+	template<class M>
+	static auto neg(M const& m)-> _Sum_t<M>
+	{
+		_Sum_t<M> res(_ExemptionTag{});
+
+		_Fixed_Kernel<T>::template neg< _size<M>() >( m.data(), res.data() );
+
+		return res;
+	}
+
+
+	template<class M, class Q>
+	static auto mul(M const& m, Q const& q)
+	{
+		if constexpr(is_Same<Q, T>::value)
+		{
+			_Sum_t<M> res(_ExemptionTag{});
+
+			_Fixed_Kernel<T>::template scale< _size<M>() >( m.data(), q, res.data() );
+
+			return res;
+		}
+		else
+		{
+			size_t constexpr R = M::STT_ROW_SIZE,  K = M::STT_COL_SIZE,  C = Q::STT_COL_SIZE;
+			Storing_Order constexpr STOR = _product_order<M, Q>();
+
+			Matrix<T, R, C, _order_of<R, C, STOR>()> res(_ExemptionTag{});
+
+			//	( m q )^T = q^T m^T
+			if constexpr(STOR == Storing_Order::ROW_FIRST)
+				_Fixed_Kernel<T>::template mul<R, K, C>( m.data(), q.data(), res.data() );
+			else
+				_Fixed_Kernel<T>::template mul<C, K, R>( q.data(), m.data(), res.data() );
+
+			return res;
+		}
+	}
+
+
+	template<class M>
+	static auto transpose(M const& m)
+	{
+		size_t constexpr R = M::STT_ROW_SIZE,  C = M::STT_COL_SIZE;
+		Storing_Order constexpr STOR = _order_of<C, R, M::STORING_ORDER>();
+
+		Matrix<T, C, R, STOR> res(_ExemptionTag{});
+
+		if constexpr(M::STORING_ORDER == Storing_Order::ROW_FIRST)
+			_Fixed_Kernel<T>::template transpose<R, C>( m.data(), res.data() );
+		else
+			_Fixed_Kernel<T>::template transpose<C, R>( m.data(), res.data() );
+
+		return res;
+	}
+
+
+	//	det and inv of a transpose are the transposes of them , which keep the buffer order .
+	template<class M>
+	static auto det(M const& m)-> T{  return _Fixed_Kernel<T>::template det<M::STT_ROW_SIZE>( m.data() );  }
+
+
+	template<class M>
+	static auto inv(M const& m)-> _Sum_t<M>
+	{
+		_Sum_t<M> res(_ExemptionTag{});
+
+		_Fixed_Kernel<T>::template inv<M::STT_ROW_SIZE>( m.data(), res.data() );
+
+		return res;
+	}
+
+
+	template<class M, class Q>
+	static auto dot(M const& m, Q const& q)-> T
+	{
+		return _Fixed_Kernel<T>::template dot< _size<M>() >( m.data(), q.data() );
+	}
+
+
+	template<class M, class Q>
+	static auto cross(M const& m, Q const& q)-> _Sum_t<M>
+	{
+		_Sum_t<M> res(_ExemptionTag{});
+
+		_Fixed_Kernel<T>::cross( m.data(), q.data(), res.data() );
+
+		return res;
+	}
+
+
+	template<class M>
+	static auto skew(M const& m)-> Matrix<T, 3, 3>
+	{
+		Matrix<T, 3, 3> res(_ExemptionTag{});
+
+		//	the transpose of skew(v) is skew(-v) .
+		if constexpr(DefaultStorOrder == Storing_Order::ROW_FIRST)
+			_Fixed_Kernel<T>::skew( m.data(), res.data() );
+		else
+		{
+			T const v[3] = {-m(0), -m(1), -m(2)};
+
+			_Fixed_Kernel<T>::skew( v, res.data() );
+		}
+
+		return res;
+	}
+
+
+	//	m q^T as a matrix of the default order .
+	template<class M, class Q>
+	static auto dyadic(M const& m, Q const& q)
+	{
+		size_t constexpr N = _size<M>();
+
+		Matrix<T, N, N> res(_ExemptionTag{});
+
+		if constexpr(DefaultStorOrder == Storing_Order::ROW_FIRST)
+			_Fixed_Kernel<T>::template dyadic<N, N>( m.data(), q.data(), res.data() );
+		else
+			_Fixed_Kernel<T>::template dyadic<N, N>( q.data(), m.data(), res.data() );
+
+		return res;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
@@ -26,6 +26,21 @@ namespace s3d
 
 	struct _Seed_Helper;
 
+	template<class>
+	struct _Has_Lazy_Product;
+
+
+	template<class T, size_t ROWS, size_t COLS, Storing_Order STOR>
+	using _Strided_Map_t
+	=	Eigen::Map
+		<	Selective_t
+			<	is_immutable<T>::value
+			,	typename _Seed_Matrix< Decay_t<T>, ROWS, COLS, STOR >::egn_Mat_t const
+			,	typename _Seed_Matrix< Decay_t<T>, ROWS, COLS, STOR >::egn_Mat_t
+			>
+		,	Eigen::Unaligned, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>
+		>;
+
 }
 //========//========//========//========//=======#//========//========//========//========//=======#
 
@@ -70,6 +85,28 @@ struct s3d::_Seed_Matrix<T, ROWS, COLS, STOR, false>
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+/**	Whether an expression holds a coefficient-wise product , which reads its operands while the
+*	result is being written . Products of the default kind are evaluated before the assignment .
+*/
+template<class EXPR>
+struct s3d::_Has_Lazy_Product : False_t{};
+
+template<template<class...> class EXPR, class...ARGS>
+struct s3d::_Has_Lazy_Product< EXPR<ARGS...> > 
+:	Boolean_Or<  _Has_Lazy_Product< Decay_t<ARGS> >...  >{};
+
+template<class LHS, class RHS>
+struct s3d::_Has_Lazy_Product< Eigen::Product<LHS, RHS, Eigen::LazyProduct> > : True_t{};
+
+template<class EXPR, int ROWS, int COLS, bool IS_INNER_PANEL>
+struct s3d::_Has_Lazy_Product< Eigen::Block<EXPR, ROWS, COLS, IS_INNER_PANEL> > 
+:	_Has_Lazy_Product< Decay_t<EXPR> >{};
+
+template<class T, std::size_t ROWS, std::size_t COLS, s3d::Storing_Order STOR>
+struct s3d::_Has_Lazy_Product< s3d::_MatrixAdaptor<T, ROWS, COLS, STOR> > : _Has_Lazy_Product<T>{};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 struct s3d::_Seed_Helper : Unconstructible
 {
 private:
@@ -101,6 +138,44 @@ public:
 	{
 		return Forward<TEMP>(temp);  
 	}
+
+
+	//	Zero-copy view on external contiguous memory .
+	template<size_t ROWS, size_t COLS, Storing_Order STOR = DefaultStorOrder, class T>
+	static auto mapped(T* const data, size_t const rows, size_t const cols)
+	{
+		using egn_Mat_t = typename _Seed_Matrix< Decay_t<T>, ROWS, COLS, STOR >::egn_Mat_t;
+		using map_t = Eigen::Map< Selective_t<is_immutable<T>::value, egn_Mat_t const, egn_Mat_t> >;
+
+		return lazy<ROWS, COLS, STOR>(  map_t( data, index(rows), index(cols) )  );
+	}
+
+	//	Zero-copy view on external memory , strides counted in elements .
+	template<size_t ROWS, size_t COLS, Storing_Order STOR = DefaultStorOrder, class T>
+	static auto mapped
+	(	T* const data, size_t const rows, size_t const cols
+	,	size_t const outer_stride, size_t const inner_stride
+	)
+	{
+		using map_t = _Strided_Map_t<T, ROWS, COLS, STOR>;
+		using stride_t = Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>;
+
+		return 
+		lazy<ROWS, COLS, STOR>
+		(	map_t
+			(	data, index(rows), index(cols), stride_t( index(outer_stride), index(inner_stride) )
+			)
+		);
+	}
+
+
+	//	Eigen counts sizes in int .
+	static auto index(size_t const n)-> int
+	{
+		assert( n <= static_cast<size_t>(std::numeric_limits<int>::max()) );
+
+		return static_cast<int>(n);
+	}
 };
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
@@ -147,15 +222,15 @@ public:
 			>
 	>
 	auto operator=(RHS&& rhs) noexcept(is_Rvalue_Reference<RHS&&>::value)
-	->	_MatrixAdaptor&{  return _seed() = Forward<RHS>(rhs),  *this;  }
+	->	_MatrixAdaptor&{  return _assign( Forward<RHS>(rhs) );  }
 
 	template<class Q, size_t _R, size_t _C, Storing_Order _S>
 	auto operator=(_MatrixAdaptor<Q, _R, _C, _S> const& ma)
-	->	_MatrixAdaptor&{  return _seed() = _Helper::seed<decltype(ma)>(ma),  *this;  }
+	->	_MatrixAdaptor&{  return _assign( _Helper::seed<decltype(ma)>(ma) );  }
 
 	template<class Q, size_t _R, size_t _C, Storing_Order _S>
 	auto operator=(_MatrixAdaptor<Q, _R, _C, _S>&& ma) noexcept
-	->	_MatrixAdaptor&{  return _seed() = _Helper::seed<decltype(ma)>(ma),  *this;  }
+	->	_MatrixAdaptor&{  return _assign( _Helper::seed<decltype(ma)>(ma) );  }
 
 	template<class Q, size_t _R, size_t _C, Storing_Order _S>
 	auto operator=(s3d::Matrix<Q, _R, _C, _S> const& m)
@@ -338,6 +413,11 @@ public:
 		
 		if constexpr(trait::is_complexible<RHS>::value)
 			return _Helper::template lazy<ROWS, COLS>(_seed()*q);
+		else if constexpr(_is_coeffwise_product<RHS>())
+			return
+			_Helper::template lazy<ROWS, RHS::STT_COL_SIZE>
+			(	_seed().lazyProduct( _Helper::seed<Q>(q) )  
+			);
 		else
 			return 
 			_Helper::template lazy<ROWS, RHS::STT_COL_SIZE>( _seed() * _Helper::seed<Q>(q) );
@@ -391,11 +471,61 @@ public:
 	}
 
 
+	//	i x j matrix whose ( r , c ) element is f(r, c) , evaluated only when it is read .
+	template<class F>
+	static auto generated(size_t const i, size_t const j, F const f)
+	{
+		return
+		_Helper::template lazy<ROWS, COLS>
+		(	_SeedMat_t::NullaryExpr
+			(	static_cast<int>(i), static_cast<int>(j)
+			,	[f](Eigen::Index const r, Eigen::Index const c)
+				{
+					return f( static_cast<size_t>(r), static_cast<size_t>(c) );  
+				}
+			)
+		);
+	}
+
+
 private:
 	friend struct _Seed_Helper;
 
 	auto _seed()-> _SeedMat_t&{  return *this;  }
 	auto _seed() const-> _SeedMat_t const&{  return *this;  }
+
+
+	template<class RHS>
+	auto _assign(RHS&& rhs)-> _MatrixAdaptor&
+	{
+		if constexpr(_Has_Lazy_Product< Decay_t<RHS> >::value)
+			_seed() = typename _SeedMat_t::PlainObject( Forward<RHS>(rhs) );
+		else
+			_seed() = Forward<RHS>(rhs);
+
+		return *this;
+	}
+
+
+	/**	Products with an inner size of 1 or of small static sizes are computed coefficient by
+	*	coefficient , so that they stay lazy inside a larger expression rather than being evaluated 
+	*	into a temporary . The threshold is the one Eigen takes for its own small products .
+	*/
+	template<class RHS>
+	static bool constexpr _is_coeffwise_product()
+	{
+		size_t constexpr K = RHS::STT_ROW_SIZE,  C = RHS::STT_COL_SIZE;
+
+		if constexpr(COLS == 1 || K == 1)
+			return true;
+		else if constexpr
+		(	trait::is_StaticSize<ROWS>::value && trait::is_StaticSize<COLS>::value
+		&&	trait::is_StaticSize<C>::value
+		)
+			return ROWS + COLS + C < EIGEN_GEMM_TO_COEFFBASED_THRESHOLD;
+		else
+			return false;
+	}
 };
 
 
@@ -408,3 +538,59 @@ static decltype(auto) operator*(T t, s3d::_MatrixAdaptor<U, ROWS, COLS, STOR> co
 	return ma*t;  
 }
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Non-owning Matrix over external memory such as sensor buffers , memory-mapped files or arrays
+*	of other libraries . A const T makes a read-only view .
+*	Strides are counted in elements along the storing order : inner_stride between neighbours in
+*	a column for COL_FIRST ( in a row for ROW_FIRST ) and outer_stride between columns ( rows ) .
+*	Vectors step by inner_stride only .
+*	Being an Eigen::Map , it is taken by Matrix operations , decompositions , least square solvers
+*	and affine transforms in place of a Matrix without any copy . Assigning to it writes into the
+*	memory , which must outlive the view .
+*/
+template<class T, std::size_t ROWS, std::size_t COLS, s3d::Storing_Order STOR>
+class s3d::MatrixView
+:	public _MatrixAdaptor< _Strided_Map_t<T, ROWS, COLS, STOR>, ROWS, COLS, STOR >
+{
+private:
+	using _Map_t = _Strided_Map_t<T, ROWS, COLS, STOR>;
+	using _Base = _MatrixAdaptor<_Map_t, ROWS, COLS, STOR>;
+
+
+public:
+	MatrixView
+	(	T* const data, size_t const rows, size_t const cols
+	,	size_t const outer_stride, size_t const inner_stride = 1
+	)
+	:	_Base
+		(	_Seed_Helper::template mapped<ROWS, COLS, STOR>
+			(	data, rows, cols, outer_stride, inner_stride
+			)
+		)
+	{
+		assert
+		(	(!trait::is_StaticSize<ROWS>::value || rows == ROWS)
+		&&	(!trait::is_StaticSize<COLS>::value || cols == COLS)
+		);
+	}
+
+	//	over contiguous memory
+	MatrixView(T* const data, size_t const rows, size_t const cols)
+	:	MatrixView( data, rows, cols, _Map_t::IsRowMajor ? cols : rows ){}
+
+	MatrixView(T* const data) : MatrixView(data, ROWS, COLS)
+	{
+		static_assert(trait::is_StaticSize<ROWS>::value && trait::is_StaticSize<COLS>::value);
+	}
+
+
+	using _Base::operator=;
+
+	auto operator=(MatrixView const& view)-> MatrixView&{  return _Base::operator=(view),  *this;  }
+
+
+	auto outer_stride() const-> size_t{  return static_cast<size_t>( _Map_t::outerStride() );  }
+	auto inner_stride() const-> size_t{  return static_cast<size_t>( _Map_t::innerStride() );  }
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
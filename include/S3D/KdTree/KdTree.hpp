@@ -0,0 +1,415 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_KD_TREE_
+#define _S3D_KD_TREE_
+
+
+#include "S3D/Euclid/Euclid.hpp"
+#include "S3D/Parallel/Parallel.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace s3d
+{
+
+	template<class T, size_t DIM>
+	class KdTree;
+
+
+	template<class POLICY, class T, size_t DIM>
+	static auto nearest_all
+	(	POLICY const& policy, KdTree<T, DIM> const& tree, PointSet<T, DIM> const& queries
+	,	size_t const k
+	)->	std::vector< Neighbor<T> >;
+
+	template<class POLICY, class T, size_t DIM>
+	static auto within_all
+	(	POLICY const& policy, KdTree<T, DIM> const& tree, PointSet<T, DIM> const& queries
+	,	T const radius
+	)->	std::vector< std::vector< Neighbor<T> > >;
+
+}
+
+
+namespace s3d::trait
+{
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t DIM)
+	,	KdTree, <T, DIM>
+	);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+/**	Static kd-tree over points , laid out without pointers : a range of points is a node whose
+*	splitting point is its median element , and the ranges before and after the median are its
+*	children . Only the splitting dimension of each interior node is kept besides the points , at
+*	its heap index where the children of node i are 2i + 1 and 2i + 2 . Halves of a range differ
+*	by one point at most , so interior nodes fill every level above the last one of them and the
+*	heap indices number fewer than twice the interior nodes .
+*	Ranges of no more than _LEAF_SIZE points are scanned .
+*/
+template<class T, std::size_t DIM>
+class s3d::KdTree
+{
+public:
+	using value_type = T;
+	using point_t = Vector<T, DIM>;
+	static size_t constexpr DIMENSION = DIM;
+
+	static_assert( trait::is_real<T>::value && DIM > 0 && trait::is_StaticSize<DIM>::value );
+
+
+	KdTree() = default;
+
+	explicit KdTree(PointSet<T, DIM> const& points) : KdTree(SEQ, points){}
+
+	//	Levels of the tree are built one after another , nodes of each level in parallel .
+	template<  class POLICY, class = Enable_if_t< trait::is_Execution_Policy<POLICY>::value >  >
+	KdTree(POLICY const& policy, PointSet<T, DIM> const& points)
+	:	_items(points.size())
+	{
+		assert( points.size() < std::numeric_limits<uint32_t>::max() );
+
+		for(size_t i = 0;  i < points.size();  ++i)
+		{
+			for(size_t d = 0;  d < DIM;  ++d)
+				_items[i].x[d] = points(i, d);
+
+			_items[i].index = static_cast<uint32_t>(i);
+		}
+
+		_build(policy);
+	}
+
+
+	auto size() const-> size_t{  return _items.size();  }
+	auto empty() const-> bool{  return _items.empty();  }
+
+
+	auto nearest(point_t const& q) const-> Nullable< Neighbor<T> >
+	{
+		if(empty())
+			return Null_t{};
+
+		return _Neighbor_Search::nearest<T>( _search_f(_coords(q)) );
+	}
+
+
+	//	The min(k, size()) nearest points in ascending order of sqrDistance .
+	auto nearest(point_t const& q, size_t const k) const-> std::vector< Neighbor<T> >
+	{
+		std::vector< Neighbor<T> > res( std::min(k, size()) );
+
+		_Neighbor_Search::k_nearest( res.size(), res.data(), _search_f(_coords(q)) );
+
+		return res;
+	}
+
+
+	//	All points no farther than radius in ascending order of sqrDistance .
+	auto within(point_t const& q, T const radius) const-> std::vector< Neighbor<T> >
+	{
+		std::vector< Neighbor<T> > res;
+
+		_Neighbor_Search::within( radius, res, _search_f(_coords(q)) );
+
+		return res;
+	}
+
+
+private:
+	struct _Item
+	{
+		T x[DIM];
+		uint32_t index;
+	};
+
+	struct _Range
+	{
+		size_t begin, end, node;
+	};
+
+
+	static size_t constexpr _LEAF_SIZE = 8;
+
+	//	A range is at most half of its parent , so no path is longer than 32 and a fixed stack is
+	//	enough for traversal .
+	static size_t constexpr _STACK_SIZE = 64;
+
+
+	std::vector<_Item> _items;
+	std::vector<uint8_t> _split_dims;
+
+	static_assert(DIM <= 256);
+
+
+	template<class POLICY, class Q, size_t D>
+	friend auto s3d::nearest_all
+	(	POLICY const&, KdTree<Q, D> const&, PointSet<Q, D> const&, size_t const
+	)->	std::vector< Neighbor<Q> >;
+
+	template<class POLICY, class Q, size_t D>
+	friend auto s3d::within_all
+	(	POLICY const&, KdTree<Q, D> const&, PointSet<Q, D> const&, Q const
+	)->	std::vector< std::vector< Neighbor<Q> > >;
+
+
+	static auto _coords(point_t const& q)-> std::array<T, DIM>
+	{
+		std::array<T, DIM> res;
+
+		for(size_t d = 0;  d < DIM;  ++d)
+			res[d] = q(d);
+
+		return res;
+	}
+
+
+	static auto _sqr_dist(std::array<T, DIM> const& q, _Item const& item)-> T
+	{
+		T res = 0;
+
+		for(size_t d = 0;  d < DIM;  ++d)
+		{
+			T const diff = item.x[d] - q[d];
+
+			res += diff*diff;
+		}
+
+		return res;
+	}
+
+
+	template<class POLICY>
+	void _build(POLICY const& policy)
+	{
+		std::vector<_Range> level, next_level;
+
+		if(size() > _LEAF_SIZE)
+			level.push_back({0, size(), 0});
+
+		auto const node_policy = _per_node(policy);
+
+		while( !level.empty() )
+		{
+			_split_dims.resize(level.back().node + 1);
+
+			Parallel_for
+			(	node_policy, level.size(), sizeof(_Range)
+			,	[this, &level](size_t const bi, size_t const ei)
+				{
+					for(size_t i = bi;  i < ei;  ++i)
+						_split(level[i]);
+				}
+			);
+
+			next_level.clear();
+
+			for(auto const& range : level)
+			{
+				size_t const mid = range.begin + (range.end - range.begin)/2;
+
+				if(mid - range.begin > _LEAF_SIZE)
+					next_level.push_back({range.begin, mid, 2*range.node + 1});
+
+				if(range.end - mid - 1 > _LEAF_SIZE)
+					next_level.push_back({mid + 1, range.end, 2*range.node + 2});
+			}
+
+			level.swap(next_level);
+		}
+	}
+
+
+	//	Nodes are few but heavy , so that each of them is a chunk of its own .
+	template<class POLICY>
+	static auto _per_node(POLICY const& policy)-> POLICY
+	{
+		if constexpr( is_Same<POLICY, Parallel_Policy>::value )
+			return Parallel_Policy{policy.nof_threads, 1};
+		else
+			return policy;
+	}
+
+
+	//	Puts the median along the dimension of the widest spread in the middle of the range .
+	void _split(_Range const& range)
+	{
+		T lo[DIM], hi[DIM];
+
+		std::fill(lo, lo + DIM, std::numeric_limits<T>::infinity());
+		std::fill(hi, hi + DIM, -std::numeric_limits<T>::infinity());
+
+		for(size_t i = range.begin;  i < range.end;  ++i)
+			for(size_t d = 0;  d < DIM;  ++d)
+				lo[d] = std::min(lo[d], _items[i].x[d]),  hi[d] = std::max(hi[d], _items[i].x[d]);
+
+		size_t dim = 0;
+
+		for(size_t d = 1;  d < DIM;  ++d)
+			if(hi[d] - lo[d] > hi[dim] - lo[dim])
+				dim = d;
+
+		size_t const mid = range.begin + (range.end - range.begin)/2;
+
+		std::nth_element
+		(	_items.begin() + range.begin, _items.begin() + mid, _items.begin() + range.end
+		,	[dim](_Item const& a, _Item const& b){  return a.x[dim] < b.x[dim];  }
+		);
+
+		_split_dims[range.node] = static_cast<uint8_t>(dim);
+	}
+
+
+	auto _search_f(std::array<T, DIM> const& q) const
+	{
+		return
+		[this, &q](T& bound, auto&& visit_f){  _search(q, bound, visit_f);  };
+	}
+
+
+	/**	Visits points of the nodes whose lower bounds are no greater than bound , nearer side
+	*	first . visit_f(index, sqr_dist, bound) may tighten bound .
+	*/
+	template<class F>
+	void _search(std::array<T, DIM> const& q, T& bound, F&& visit_f) const
+	{
+		struct Entry
+		{
+			size_t begin, end, node;
+			T sqr_dist_bound;
+		};
+
+		Entry stack[_STACK_SIZE];
+		size_t top = 0;
+
+		stack[top++] = {0, size(), 0, T(0)};
+
+		while(top > 0)
+		{
+			Entry const entry = stack[--top];
+
+			if(entry.sqr_dist_bound > bound)
+				continue;
+
+			if(entry.end - entry.begin <= _LEAF_SIZE)
+			{
+				for(size_t i = entry.begin;  i < entry.end;  ++i)
+					visit_f( _items[i].index, _sqr_dist(q, _items[i]), bound );
+
+				continue;
+			}
+
+			size_t const mid = entry.begin + (entry.end - entry.begin)/2,  dim = _split_dims[entry.node];
+
+			visit_f( _items[mid].index, _sqr_dist(q, _items[mid]), bound );
+
+			T const diff = q[dim] - _items[mid].x[dim];
+
+			T const far_bound = std::max(entry.sqr_dist_bound, diff*diff);
+
+			Entry const
+				lower{entry.begin, mid, 2*entry.node + 1, diff < 0 ? entry.sqr_dist_bound : far_bound},
+				upper{mid + 1, entry.end, 2*entry.node + 2, diff < 0 ? far_bound : entry.sqr_dist_bound},
+				near_side = diff < 0 ? lower : upper,
+				far_side = diff < 0 ? upper : lower;
+
+			assert(top + 2 <= _STACK_SIZE);
+
+			stack[top++] = far_side,  stack[top++] = near_side;
+		}
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	The min(k, tree.size()) nearest points of each query in ascending order , flattened so that
+*	those of queries(i) are at [i*min(k, tree.size()), (i + 1)*min(k, tree.size())) .
+*/
+template<class POLICY, class T, std::size_t DIM>
+auto s3d::nearest_all
+(	POLICY const& policy, KdTree<T, DIM> const& tree, PointSet<T, DIM> const& queries
+,	size_t const k
+)->	std::vector< Neighbor<T> >
+{
+	size_t const kk = std::min(k, tree.size());
+
+	std::vector< Neighbor<T> > res(queries.size()*kk);
+
+	if(kk == 0)
+		return res;
+
+	T const* Q[DIM];
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		Q[d] = queries.lane_data(d);
+
+	Parallel_for
+	(	policy, queries.size(), kk*sizeof(Neighbor<T>)
+	,	[&tree, &res, &Q, kk](size_t const bi, size_t const ei)
+		{
+			std::array<T, DIM> q;
+
+			for(size_t i = bi;  i < ei;  ++i)
+			{
+				for(size_t d = 0;  d < DIM;  ++d)
+					q[d] = Q[d][i];
+
+				_Neighbor_Search::k_nearest( kk, res.data() + i*kk, tree._search_f(q) );
+			}
+		}
+	);
+
+	return res;
+}
+
+
+//	res[i] holds the points within radius from queries(i) in ascending order of sqrDistance .
+template<class POLICY, class T, std::size_t DIM>
+auto s3d::within_all
+(	POLICY const& policy, KdTree<T, DIM> const& tree, PointSet<T, DIM> const& queries
+,	T const radius
+)->	std::vector< std::vector< Neighbor<T> > >
+{
+	std::vector< std::vector< Neighbor<T> > > res(queries.size());
+
+	T const* Q[DIM];
+
+	for(size_t d = 0;  d < DIM;  ++d)
+		Q[d] = queries.lane_data(d);
+
+	Parallel_for
+	(	policy, queries.size(), sizeof(res[0])
+	,	[&tree, &res, &Q, radius](size_t const bi, size_t const ei)
+		{
+			std::array<T, DIM> q;
+
+			for(size_t i = bi;  i < ei;  ++i)
+			{
+				for(size_t d = 0;  d < DIM;  ++d)
+					q[d] = Q[d][i];
+
+				_Neighbor_Search::within( radius, res[i], tree._search_f(q) );
+			}
+		}
+	);
+
+	return res;
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#endif // end of #ifndef _S3D_KD_TREE_
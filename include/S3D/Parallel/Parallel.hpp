@@ -0,0 +1,350 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_PARALLEL_
+#define _S3D_PARALLEL_
+
+
+#include "S3D/Hamilton/Hamilton.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+
+namespace s3d
+{
+
+	struct Sequential_Policy;
+
+	struct Parallel_Policy;
+
+
+	size_t constexpr CACHE_LINE_SIZE = 64;
+
+
+	class _Thread_Pool;
+
+
+	template<class F>
+	static void Parallel_for
+	(	Parallel_Policy const& policy, size_t const nof_elems, size_t const elem_size, F&& f
+	);
+
+	template<class F>
+	static void Parallel_for
+	(	Parallel_Policy const& policy, void const* const base
+	,	size_t const nof_elems, size_t const elem_size, F&& f
+	);
+
+	template<class F>
+	static void Parallel_for
+	(	Sequential_Policy const& policy, size_t const nof_elems, size_t const elem_size, F&& f
+	);
+
+	template<class F>
+	static void Parallel_for
+	(	Sequential_Policy const& policy, void const* const base
+	,	size_t const nof_elems, size_t const elem_size, F&& f
+	);
+
+}
+
+
+namespace s3d::trait
+{
+
+	template<class P>
+	struct is_Execution_Policy;
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+struct s3d::Sequential_Policy{};
+
+
+struct s3d::Parallel_Policy
+{
+	size_t nof_threads = 0; // 0 for std::thread::hardware_concurrency()
+	size_t grain_size = 4096; // minimum number of elements a chunk holds
+};
+
+
+namespace s3d
+{
+
+	inline auto constexpr SEQ = Sequential_Policy{};
+	inline auto constexpr PAR = Parallel_Policy{};
+
+}
+
+
+template<class P>
+struct s3d::trait::is_Execution_Policy
+:	Boolean
+	<	is_Same< Decay_t<P>, Sequential_Policy >::value
+	||	is_Same< Decay_t<P>, Parallel_Policy >::value
+	>{};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Process-wide workers that Parallel_for hands its chunks to , spawned on first demand and
+*	kept asleep between calls so that calling Parallel_for in a loop spawns no thread .
+*	One job runs at a time . A Parallel_for issued from inside a job runs on its calling thread .
+*/
+class s3d::_Thread_Pool
+{
+public:
+	static auto instance()-> _Thread_Pool&
+	{
+		static _Thread_Pool pool;
+
+		return pool;
+	}
+
+
+	static auto is_in_job()-> bool&
+	{
+		thread_local bool in_job = false;
+
+		return in_job;
+	}
+
+
+	//	Calls f() on nof_helpers workers and on the calling thread , returning after all have .
+	template<class F>
+	void run(size_t const nof_helpers, F& f)
+	{
+		std::lock_guard<std::mutex> const job_lock(_job_mutex);
+
+		{
+			std::lock_guard<std::mutex> const lock(_mutex);
+
+			while(_workers.size() < nof_helpers)
+				_workers.emplace_back
+				(	[this, idx = _workers.size(), gen = _generation]{  _loop(idx, gen);  }
+				);
+
+			_call = [](void* const context){  (*static_cast<F*>(context))();  };
+			_context = &f;
+			_nof_helpers = _nof_running = nof_helpers;
+			++_generation;
+		}
+
+		_wake.notify_all();
+
+		_Job_Scope const scope;
+
+		f();
+
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		_done.wait( lock, [this]{  return _nof_running == 0;  } );
+	}
+
+
+	~_Thread_Pool()
+	{
+		{
+			std::lock_guard<std::mutex> const lock(_mutex);
+
+			_stop = true;
+		}
+
+		_wake.notify_all();
+
+		for(auto& worker : _workers)
+			worker.join();
+	}
+
+
+private:
+	struct _Job_Scope
+	{
+		_Job_Scope(){  is_in_job() = true;  }
+		~_Job_Scope(){  is_in_job() = false;  }
+	};
+
+
+	std::mutex _job_mutex, _mutex;
+	std::condition_variable _wake, _done;
+	std::vector<std::thread> _workers;
+
+	void (*_call)(void*) = nullptr;
+	void* _context = nullptr;
+	size_t _generation = 0, _nof_helpers = 0, _nof_running = 0;
+	bool _stop = false;
+
+
+	_Thread_Pool() = default;
+
+
+	void _loop(size_t const idx, size_t seen)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		for(;;)
+		{
+			_wake.wait( lock, [this, seen]{  return _stop || _generation != seen;  } );
+
+			if(_stop)
+				return;
+
+			seen = _generation;
+
+			if(idx >= _nof_helpers)
+				continue;
+
+			lock.unlock();
+
+			{
+				_Job_Scope const scope;
+
+				_call(_context);
+			}
+
+			lock.lock();
+
+			if(--_nof_running == 0)
+				_done.notify_one();
+		}
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Calls f(begin_idx, end_idx) over [0, nof_elems) split into chunks .
+*	Threads keep pulling the next chunk from a shared counter until none is left , so faster
+*	threads take over the work of slower ones . The threads are those of _Thread_Pool .
+*	Chunk sizes are multiples of the number of elem_size bytes elements filling whole cache 
+*	lines . Boundaries fall on cache lines only when element 0 does ; give the base address to
+*	the overload below to have them aligned wherever the range lies in memory .
+*	The first exception thrown by f is rethrown after every chunk has been returned from .
+*/
+template<class F>
+void s3d::Parallel_for
+(	Parallel_Policy const& policy, size_t const nof_elems, size_t const elem_size, F&& f
+)
+{
+	Parallel_for( policy, nullptr, nof_elems, elem_size, Forward<F>(f) );
+}
+
+
+/**	Boundaries between chunks fall on cache-line addresses of the array of elem_size bytes
+*	elements starting at base , so that threads writing neighbouring chunks never share a line .
+*	A base not on a multiple of the element alignment is split as if it were at element 0 .
+*/
+template<class F>
+void s3d::Parallel_for
+(	Parallel_Policy const& policy, void const* const base
+,	size_t const nof_elems, size_t const elem_size, F&& f
+)
+{
+	if(nof_elems == 0)
+		return;
+
+	size_t const
+		hw_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1),
+		nof_threads = policy.nof_threads == 0 ? hw_threads : policy.nof_threads,
+		align = std::lcm(CACHE_LINE_SIZE, elem_size) / elem_size,
+		chunk
+		=	(	std::max<size_t>
+				(	{policy.grain_size, nof_elems / (8*nof_threads), size_t(1)}
+				)
+			+	align - 1
+			)
+		/	align * align;
+
+	//	chunk c covers [c*chunk - shift, (c + 1)*chunk - shift) clamped to the range .
+	size_t shift = 0;
+
+	if(base != nullptr)
+	{
+		auto const offset
+		=	static_cast<size_t>( reinterpret_cast<std::uintptr_t>(base) % CACHE_LINE_SIZE );
+
+		for(size_t b = 0;  b < align;  ++b)
+			if( (offset + b*elem_size) % CACHE_LINE_SIZE == 0 )
+			{
+				shift = (align - b) % align;
+
+				break;
+			}
+	}
+
+	size_t const
+		nof_chunks = (nof_elems + shift + chunk - 1) / chunk,
+		nof_workers = std::min(nof_threads, nof_chunks);
+
+	if(nof_workers <= 1 || _Thread_Pool::is_in_job())
+		return (void)f(size_t(0), nof_elems);
+
+	std::atomic<size_t> next_chunk{0};
+	std::exception_ptr eptr = nullptr;
+	std::mutex eptr_mutex;
+
+	auto work_f
+	=	[&]
+		{
+			try
+			{
+				for
+				(	size_t c = next_chunk.fetch_add(1, std::memory_order_relaxed)
+				;	c < nof_chunks
+				;	c = next_chunk.fetch_add(1, std::memory_order_relaxed)
+				)
+					f
+					(	c == 0 ? size_t(0) : c*chunk - shift
+					,	std::min(nof_elems, c*chunk + chunk - shift) 
+					);
+			}
+			catch(...)
+			{
+				std::lock_guard<std::mutex> const lock(eptr_mutex);
+
+				if(eptr == nullptr)
+					eptr = std::current_exception();
+
+				next_chunk.store(nof_chunks, std::memory_order_relaxed);
+			}
+		};
+
+	_Thread_Pool::instance().run(nof_workers - 1, work_f);
+
+	if(eptr != nullptr)
+		std::rethrow_exception(eptr);
+}
+
+
+//	Calls f(0, nof_elems) on the calling thread , so that batch kernels can take either policy .
+template<class F>
+void s3d::Parallel_for
+(	Sequential_Policy const&, size_t const nof_elems, size_t const, F&& f
+)
+{
+	if(nof_elems != 0)
+		f(size_t(0), nof_elems);
+}
+
+
+template<class F>
+void s3d::Parallel_for
+(	Sequential_Policy const& policy, void const* const, size_t const nof_elems, size_t const, F&& f
+)
+{
+	Parallel_for( policy, nof_elems, size_t(1), Forward<F>(f) );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#endif // end of #ifndef _S3D_PARALLEL_
@@ -0,0 +1,200 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_POINTSET_
+#define _S3D_POINTSET_
+
+
+#include "S3D/Hamilton/Hamilton.hpp"
+#include <initializer_list>
+#include <vector>
+
+
+namespace s3d
+{
+
+	template<class T, size_t DIM>
+	class PointSet;
+
+	struct _Lane_IO;
+
+}
+
+
+namespace s3d::trait
+{
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, size_t DIM)
+	,	PointSet, <T, DIM>
+	);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+/**	Structure of arrays : each coordinate of the points is stored in its own contiguous lane ,
+*	so that a pass over one coordinate of all points runs on packed data .
+*/
+template<class T, std::size_t DIM>
+class s3d::PointSet
+{
+public:
+	using value_type = T;
+	using point_t = Vector<T, DIM>;
+	static size_t constexpr DIMENSION = DIM;
+
+	static_assert( trait::is_real<T>::value && DIM > 0 && trait::is_StaticSize<DIM>::value );
+
+
+	PointSet() = default;
+
+	explicit PointSet(size_t const nof_points){  resize(nof_points);  }
+
+	template<  class CON, class = Enable_if_t< is_iterable<CON>::value >  >
+	PointSet(CON const& con)
+	{
+		reserve( Size(con) );
+
+		for(auto const& p : con)
+			push_back(p);
+	}
+
+	PointSet(std::initializer_list<point_t>&& iL)
+	{
+		reserve(iL.size());
+
+		for(auto const& p : iL)
+			push_back(p);
+	}
+
+
+	auto size() const-> size_t{  return _lanes[0].size();  }
+	auto empty() const-> bool{  return size() == 0;  }
+	auto capacity() const-> size_t{  return _lanes[0].capacity();  }
+
+
+	auto reserve(size_t const n)-> PointSet&
+	{
+		for(auto& lane : _lanes)
+			lane.reserve(n);
+
+		return *this;
+	}
+
+	auto resize(size_t const n)-> PointSet&
+	{
+		for(auto& lane : _lanes)
+			lane.resize(n, T(0));
+
+		return *this;
+	}
+
+	auto clear()-> PointSet&
+	{
+		for(auto& lane : _lanes)
+			lane.clear();
+
+		return *this;
+	}
+
+
+	auto point(size_t const idx) const-> point_t
+	{
+		assert(idx < size());
+
+		point_t res;
+
+		for(size_t d = 0;  d < DIM;  ++d)
+			res(d) = _lanes[d][idx];
+
+		return res;
+	}
+
+	auto operator()(size_t const idx) const-> point_t{  return point(idx);  }
+
+	auto operator()(size_t const idx, size_t const d) const-> T const&{  return _lanes[d][idx];  }
+	auto operator()(size_t const idx, size_t const d)-> T&{  return _lanes[d][idx];  }
+
+
+	auto set(size_t const idx, point_t const& p)-> PointSet&
+	{
+		assert(idx < size());
+
+		for(size_t d = 0;  d < DIM;  ++d)
+			_lanes[d][idx] = p(d);
+
+		return *this;
+	}
+
+	auto push_back(point_t const& p)-> PointSet&
+	{
+		for(size_t d = 0;  d < DIM;  ++d)
+			_lanes[d].push_back( p(d) );
+
+		return *this;
+	}
+
+
+	auto lane_data(size_t const d) const-> T const*{  return _lanes[d].data();  }
+	auto lane_data(size_t const d)-> T*{  return _lanes[d].data();  }
+
+
+	/**	Zero-copy views of the d-th coordinates of all points .
+	*	They behave like Vector<T> and are invalidated by anything changing size() or capacity() .
+	*/
+	decltype(auto) lane(size_t const d) const
+	{
+		return _Seed_Helper::template mapped<DYNAMIC, 1>( lane_data(d), size(), 1 );
+	}
+
+	decltype(auto) lane(size_t const d)
+	{
+		return _Seed_Helper::template mapped<DYNAMIC, 1>( lane_data(d), size(), 1 );
+	}
+
+
+private:
+	std::vector<T> _lanes[DIM];
+};
+
+
+namespace s3d
+{
+
+	template
+	<	class CON, class P = Decay_t< trait::Deref_t<CON> >
+	,	class = Enable_if_t< is_iterable<CON>::value && trait::is_StrictVec<P>::value >
+	>
+	PointSet(CON const&)
+	->	PointSet< trait::value_t<P>, P::STT_ROW_SIZE * P::STT_COL_SIZE >;
+
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+//	Gathers the idx-th element of N lanes into a local array and scatters it back .
+struct s3d::_Lane_IO : Unconstructible
+{
+	template<class T, size_t N>
+	static void load(T const* const (&lanes)[N], size_t const idx, T (&a)[N])
+	{
+		for(size_t d = 0;  d < N;  ++d)
+			a[d] = lanes[d][idx];
+	}
+
+	template<class T, size_t N>
+	static void store(T const (&a)[N], T* const (&lanes)[N], size_t const idx)
+	{
+		for(size_t d = 0;  d < N;  ++d)
+			lanes[d][idx] = a[d];
+	}
+};
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#endif // end of #ifndef _S3D_POINTSET_
@@ -10,6 +10,10 @@
 
 
 #include "S3D/Hamilton/Hamilton.hpp"
+#include "S3D/Parallel/Parallel.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+#include <cstdint>
+#include <vector>
 
 
 namespace s3d
@@ -21,6 +25,46 @@ namespace s3d
 	template<class T>  
 	class UnitQuaternion;
 
+
+	template<class T>
+	class LiteralQuaternion;
+
+
+	struct _Quaternion_Interpolation;
+
+
+	template<class POLICY, class T>
+	static auto slerp_all
+	(	POLICY const& policy, PointSet<T, 4> const& q0s, PointSet<T, 4> const& q1s
+	,	std::vector<T> const& ts
+	)->	PointSet<T, 4>;
+
+	template<class POLICY, class T>
+	static auto nlerp_all
+	(	POLICY const& policy, PointSet<T, 4> const& q0s, PointSet<T, 4> const& q1s
+	,	std::vector<T> const& ts
+	)->	PointSet<T, 4>;
+
+	template<class POLICY, class T>
+	static auto squad_all
+	(	POLICY const& policy, PointSet<T, 4> const& keys, std::vector<T> const& params
+	)->	PointSet<T, 4>;
+
+
+	template<size_t BITS>
+	class Packed_UnitQuaternion;
+
+	struct _Quaternion_Packing;
+
+
+	template<size_t BITS, class POLICY, class T>
+	static auto encode_all(POLICY const& policy, PointSet<T, 4> const& qs)
+	->	std::vector< Packed_UnitQuaternion<BITS> >;
+
+	template<class T, class POLICY, size_t BITS>
+	static auto decode_all(POLICY const& policy, std::vector< Packed_UnitQuaternion<BITS> > const& pqs)
+	->	PointSet<T, 4>;
+
 }
 
 
@@ -351,6 +395,595 @@ auto s3d::UnitQuaternion<T>::Slerp
 
 	return uq0 * UnitQuaternion(ct, st*v);
 }
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+/**	Quaternion of a literal type , computed in constant expressions as LiteralMat is .
+*	Rotations known at compile time , e.g. from Euler angles or from an axis and an angle , are
+*	thus baked into the binary . It converts into Quaternion by copying 4 scalars , and a unit one
+*	goes into UnitQuaternion or Rotation with no normalization by Skipped< UnitQuaternion<T> >(q) .
+*/
+template<class T>
+class s3d::LiteralQuaternion
+{
+public:
+	static_assert(trait::is_real<T>::value);
+
+	using scalar_type = T;
+
+
+	constexpr LiteralQuaternion(T const w = 0, T const x = 0, T const y = 0, T const z = 0)
+	:	_w(w), _v(x, y, z){}
+
+	constexpr LiteralQuaternion(T const w, LiteralVec<T, 3> const& v) : _w(w), _v(v){}
+	constexpr LiteralQuaternion(LiteralVec<T, 3> const& v) : LiteralQuaternion(0, v){}
+
+
+	//	Unit quaternion rotating in the same order as Rotation<T, 3>(alpha, beta, gamma) .
+	static constexpr auto Euler_angles(T const alpha, T const beta, T const gamma)
+	->	LiteralQuaternion
+	{
+		using _Math = _Literal_Math<T>;
+
+		T const
+			ha = T(.5)*alpha, hb = T(.5)*beta, hg = T(.5)*gamma,
+			ca = _Math::cos(ha), cb = _Math::cos(hb), cg = _Math::cos(hg),
+			sa = _Math::sin(ha), sb = _Math::sin(hb), sg = _Math::sin(hg);
+
+		return
+		{	ca*cb*cg + sa*sb*sg
+		,	sa*cb*cg - ca*sb*sg
+		,	ca*sb*cg + sa*cb*sg
+		,	ca*cb*sg - sa*sb*cg
+		};
+	}
+
+	//	Unit quaternion rotating by theta radian along axis , which needs not to be normalized .
+	static constexpr auto Spin(LiteralVec<T, 3> const& axis, T const theta)-> LiteralQuaternion
+	{
+		T const h = T(.5)*theta;
+
+		return {_Literal_Math<T>::cos(h), _Literal_Math<T>::sin(h)*axis.normalized()};
+	}
+
+
+	operator Quaternion<T>() const{  return {w(), x(), y(), z()};  }
+
+
+	constexpr auto w() const-> T{  return _w;  }		constexpr auto w()-> T&{  return _w;  }
+	constexpr auto x() const-> T{  return _v(0);  }	constexpr auto x()-> T&{  return _v(0);  }
+	constexpr auto y() const-> T{  return _v(1);  }	constexpr auto y()-> T&{  return _v(1);  }
+	constexpr auto z() const-> T{  return _v(2);  }	constexpr auto z()-> T&{  return _v(2);  }
+
+	constexpr auto v() const-> LiteralVec<T, 3> const&{  return _v;  }
+	constexpr auto v()-> LiteralVec<T, 3>&{  return _v;  }
+
+	constexpr auto operator+() const-> LiteralQuaternion{  return *this;  }
+	constexpr auto operator-() const-> LiteralQuaternion{  return {-w(), -v()};  }
+
+	constexpr auto sqr_norm() const-> T{  return w()*w() + v().dot(v());  }
+	constexpr auto norm() const-> T{  return _Literal_Math<T>::sqrt( sqr_norm() );  }
+	constexpr auto normalized() const-> LiteralQuaternion{  return *this / norm();  }
+	constexpr auto normalize()-> LiteralQuaternion&{  return *this = normalized();  }
+
+	constexpr auto conjugate() const-> LiteralQuaternion{  return {w(), -v()};  }
+	constexpr auto inv() const-> LiteralQuaternion{  return conjugate() / sqr_norm();  }
+
+	constexpr auto operator+(LiteralQuaternion const& q) const
+	->	LiteralQuaternion{  return {w() + q.w(), v() + q.v()};  }
+
+	constexpr auto operator-(LiteralQuaternion const& q) const
+	->	LiteralQuaternion{  return {w() - q.w(), v() - q.v()};  }
+
+	constexpr auto operator*(T const s) const-> LiteralQuaternion{  return {w()*s, v()*s};  }
+
+	constexpr auto operator*(LiteralQuaternion const& q) const-> LiteralQuaternion
+	{
+		return {w()*q.w() - v().dot(q.v()), w()*q.v() + q.w()*v() + v().cross(q.v())};
+	}
+
+	constexpr auto operator/(T const s) const-> LiteralQuaternion{  return {w()/s, v()/s};  }
+
+
+	//	Rotation matrix of a unit quaternion , as Rotation<T, 3> builds it .
+	constexpr auto ortho_mat() const-> LiteralMat<T, 3, 3>
+	{
+		T const
+			ww = w()*w(), xx = x()*x(), yy = y()*y(), zz = z()*z(),
+			xy = x()*y(), xz = x()*z(), yz = y()*z(), wx = w()*x(), wy = w()*y(), wz = w()*z();
+
+		return
+		{	ww + xx - yy - zz,	T(2)*(xy - wz),		T(2)*(xz + wy)
+		,	T(2)*(xy + wz),		ww - xx + yy - zz,	T(2)*(yz - wx)
+		,	T(2)*(xz - wy),		T(2)*(yz + wx),		ww - xx - yy + zz
+		};
+	}
+
+
+private:
+	T _w;
+	LiteralVec<T, 3> _v;
+};
+
+
+template<  class S, class T, class = sgm::Enable_if_t< sgm::is_Convertible<S, double>::value >  >
+static constexpr auto operator*(S const s, s3d::LiteralQuaternion<T> const& q){  return q*T(s);  }
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+/**	Interpolation kernels on quaternions held in 4 lanes of a PointSet : w, x, y, z .
+*	Slerp evaluates sin(t*theta)/sin(theta) by the polynomial of D. Eberly ,
+*	" A Fast and Accurate Algorithm for Computing SLERP " , so that no trigonometric function
+*	is called and the loop over lanes has no branch but selects .
+*/
+struct s3d::_Quaternion_Interpolation : Unconstructible
+{
+	template<class T>
+	static void slerp(T const (&q0)[4], T const (&q1)[4], T const t, T (&res)[4])
+	{
+		T const
+			dot = q0[0]*q1[0] + q0[1]*q1[1] + q0[2]*q1[2] + q0[3]*q1[3],
+			sign = dot < 0 ? T(-1) : T(1),
+			xm1 = sign*dot - T(1),
+			d = T(1) - t,  tt = t*t,  dd = d*d;
+
+		T ft = 1,  fd = 1;
+
+		for(size_t i = _NOF_TERMS;  i-- > 0;)
+		{
+			ft = T(1) + ft*( _u<T>(i)*tt - _v<T>(i) )*xm1;
+			fd = T(1) + fd*( _u<T>(i)*dd - _v<T>(i) )*xm1;
+		}
+
+		T const c0 = d*fd,  c1 = sign*t*ft;
+
+		for(size_t i = 0;  i < 4;  ++i)
+			res[i] = c0*q0[i] + c1*q1[i];
+	}
+
+
+	template<class T>
+	static void nlerp(T const (&q0)[4], T const (&q1)[4], T const t, T (&res)[4])
+	{
+		T const
+			dot = q0[0]*q1[0] + q0[1]*q1[1] + q0[2]*q1[2] + q0[3]*q1[3],
+			c0 = T(1) - t,  c1 = dot < 0 ? -t : t;
+
+		for(size_t i = 0;  i < 4;  ++i)
+			res[i] = c0*q0[i] + c1*q1[i];
+
+		T const s
+		=	T(1) / std::sqrt( res[0]*res[0] + res[1]*res[1] + res[2]*res[2] + res[3]*res[3] );
+
+		for(auto& r : res)
+			r *= s;
+	}
+
+
+	template<class T>
+	static void squad
+	(	T const (&q0)[4], T const (&q1)[4], T const (&s0)[4], T const (&s1)[4], T const t
+	,	T (&res)[4]
+	)
+	{
+		T a[4], b[4];
+
+		_slerp_along(q0, q1, t, a),  _slerp_along(s0, s1, t, b);
+		_slerp_along( a, b, T(2)*t*(T(1) - t), res );
+	}
+
+
+	/**	Inner control points of Squad making the spline through keys C1-continuous :
+	*	s_i = q_i * exp( -( log(q_i^-1 * q_(i+1)) + log(q_i^-1 * q_(i-1)) ) / 4 ) .
+	*	Keys are flipped to the hemisphere of their predecessors beforehand .
+	*/
+	template<class T>
+	static auto control_points(PointSet<T, 4>& keys)-> PointSet<T, 4>
+	{
+		size_t const n = keys.size();
+
+		for(size_t k = 1;  k < n;  ++k)
+		{
+			T dot = 0;
+
+			for(size_t d = 0;  d < 4;  ++d)
+				dot += keys(k - 1, d)*keys(k, d);
+
+			if(dot < 0)
+				for(size_t d = 0;  d < 4;  ++d)
+					keys(k, d) = -keys(k, d);
+		}
+
+		PointSet<T, 4> res = keys;
+
+		for(size_t k = 1;  k + 1 < n;  ++k)
+		{
+			Quaternion<T> const q = _to_Qtn(keys, k),  iq = q.conjugate();
+
+			Vector<T, 3> const
+				v = -T(.25)*( _log(iq*_to_Qtn(keys, k + 1)) + _log(iq*_to_Qtn(keys, k - 1)) );
+
+			Quaternion<T> const s = q*_exp<T>(v);
+
+			res.set( k, Vector<T, 4>{s.w(), s.x(), s.y(), s.z()} );
+		}
+
+		return res;
+	}
+
+
+	//	res(k) = f( q0s(k), q1s(k), ts[k] ) .
+	template<class POLICY, class T, class F>
+	static auto pairwise
+	(	POLICY const& policy, PointSet<T, 4> const& q0s, PointSet<T, 4> const& q1s
+	,	std::vector<T> const& ts, F&& f
+	)->	PointSet<T, 4>
+	{
+		assert( q0s.size() == ts.size() && q1s.size() == ts.size() );
+
+		PointSet<T, 4> res( ts.size() );
+		T const *Q0[4], *Q1[4];
+		T* Res[4];
+
+		for(size_t d = 0;  d < 4;  ++d)
+			Q0[d] = q0s.lane_data(d),  Q1[d] = q1s.lane_data(d),  Res[d] = res.lane_data(d);
+
+		Parallel_for
+		(	policy, ts.size(), sizeof(T)
+		,	[&Q0, &Q1, &Res, &ts, &f](size_t const bi, size_t const ei)
+			{
+				for(size_t k = bi;  k < ei;  ++k)
+				{
+					T a[4], b[4], c[4];
+
+					_Lane_IO::load(Q0, k, a),  _Lane_IO::load(Q1, k, b);
+
+					f(a, b, ts[k], c);
+
+					_Lane_IO::store(c, Res, k);
+				}
+			}
+		);
+
+		return res;
+	}
+
+
+private:
+	static size_t constexpr _NOF_TERMS = 8;
+	static double constexpr _MU = 1.85298109240830;
+
+
+	template<class T>
+	static auto constexpr _u(size_t const i)-> T
+	{
+		size_t const n = i + 1;
+
+		return i + 1 < _NOF_TERMS ? T( 1.0/(n*(2*n + 1)) ) : T( _MU/(n*(2*n + 1)) );
+	}
+
+	template<class T>
+	static auto constexpr _v(size_t const i)-> T
+	{
+		size_t const n = i + 1;
+
+		return i + 1 < _NOF_TERMS ? T( double(n)/(2*n + 1) ) : T( _MU*n/(2*n + 1) );
+	}
+
+
+	//	Slerp without turning to the shortest arc , which would break the continuity of Squad .
+	template<class T>
+	static void _slerp_along(T const (&q0)[4], T const (&q1)[4], T const t, T (&res)[4])
+	{
+		T const dot = q0[0]*q1[0] + q0[1]*q1[1] + q0[2]*q1[2] + q0[3]*q1[3];
+
+		if(dot >= 0)
+			return slerp(q0, q1, t, res);
+
+		T const 
+			theta = std::acos( std::max(dot, T(-1)) ),
+			s = std::sin(theta),
+			c0 = std::sin( (T(1) - t)*theta )/s,  c1 = std::sin(t*theta)/s;
+
+		for(size_t i = 0;  i < 4;  ++i)
+			res[i] = c0*q0[i] + c1*q1[i];
+	}
+
+
+	template<class T>
+	static auto _to_Qtn(PointSet<T, 4> const& ps, size_t const idx)-> Quaternion<T>
+	{
+		return {ps(idx, 0), ps(idx, 1), ps(idx, 2), ps(idx, 3)};
+	}
+
+	template<class T>
+	static auto _log(Quaternion<T> const& q)-> Vector<T, 3>
+	{
+		T const s = q.v().norm();
+
+		return s > 0 ? Vector<T, 3>( std::atan2(s, q.w())/s*q.v() ) : q.v();
+	}
+
+	template<class T>
+	static auto _exp(Vector<T, 3> const& v)-> Quaternion<T>
+	{
+		T const theta = v.norm();
+
+		return theta > 0 ? Quaternion<T>( std::cos(theta), std::sin(theta)/theta*v ) : Quaternion<T>(1);
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+//	res(k) = Slerp( q0s(k), q1s(k), ts[k] ) along the shortest arc .
+template<class POLICY, class T>
+auto s3d::slerp_all
+(	POLICY const& policy, PointSet<T, 4> const& q0s, PointSet<T, 4> const& q1s
+,	std::vector<T> const& ts
+)->	PointSet<T, 4>
+{
+	return
+	_Quaternion_Interpolation::pairwise
+	(	policy, q0s, q1s, ts
+	,	[](T const (&a)[4], T const (&b)[4], T const t, T (&c)[4])
+		{
+			_Quaternion_Interpolation::slerp(a, b, t, c);
+		}
+	);
+}
+
+
+/**	Normalized linear interpolation , which is faster than slerp_all but does not move with
+*	constant angular speed .
+*/
+template<class POLICY, class T>
+auto s3d::nlerp_all
+(	POLICY const& policy, PointSet<T, 4> const& q0s, PointSet<T, 4> const& q1s
+,	std::vector<T> const& ts
+)->	PointSet<T, 4>
+{
+	return
+	_Quaternion_Interpolation::pairwise
+	(	policy, q0s, q1s, ts
+	,	[](T const (&a)[4], T const (&b)[4], T const t, T (&c)[4])
+		{
+			_Quaternion_Interpolation::nlerp(a, b, t, c);
+		}
+	);
+}
+
+
+/**	Samples the C1-continuous Squad spline through keys at params , where a parameter u in
+*	[0, keys.size() - 1] lies between keys(floor(u)) and keys(floor(u) + 1) .
+*/
+template<class POLICY, class T>
+auto s3d::squad_all
+(	POLICY const& policy, PointSet<T, 4> const& keys, std::vector<T> const& params
+)->	PointSet<T, 4>
+{
+	assert( !keys.empty() );
+
+	PointSet<T, 4> res( params.size() ),  qs = keys;
+	PointSet<T, 4> const ss = _Quaternion_Interpolation::control_points(qs);
+
+	T const *Q[4], *S[4];
+	T* Res[4];
+
+	for(size_t d = 0;  d < 4;  ++d)
+		Q[d] = qs.lane_data(d),  S[d] = ss.lane_data(d),  Res[d] = res.lane_data(d);
+
+	size_t const last = keys.size() - 1;
+
+	Parallel_for
+	(	policy, params.size(), sizeof(T)
+	,	[&Res, &Q, &S, &params, last](size_t const bi, size_t const ei)
+		{
+			for(size_t k = bi;  k < ei;  ++k)
+			{
+				T const u = std::clamp( params[k], T(0), T(last) );
+				size_t const i = std::min( static_cast<size_t>(u), last == 0 ? 0 : last - 1 );
+				size_t const j = std::min(i + 1, last);
+
+				T q0[4], q1[4], s0[4], s1[4], c[4];
+
+				_Lane_IO::load(Q, i, q0),  _Lane_IO::load(Q, j, q1);
+				_Lane_IO::load(S, i, s0),  _Lane_IO::load(S, j, s1);
+
+				_Quaternion_Interpolation::squad( q0, q1, s0, s1, u - T(i), c );
+				_Lane_IO::store(c, Res, k);
+			}
+		}
+	);
+
+	return res;
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+/**	UnitQuaternion quantized into BITS = 32 or 48 bits by the " smallest three " scheme .
+*	q and -q being the same rotation , the largest component is made positive and dropped ,
+*	so only its index ( 2 bits ) and the other three components , which lie in
+*	[-1/sqrt(2), 1/sqrt(2)] , are stored with 10 or 15 bits each .
+*	The angle between the decoded rotation and the original one is at most MAX_ANGULAR_ERROR
+*	radian to the first order .
+*/
+template<std::size_t BITS>
+class s3d::Packed_UnitQuaternion
+{
+private:
+	static_assert(BITS == 32 || BITS == 48);
+
+	static unsigned constexpr _COMP_BITS = BITS == 32 ? 10 : 15;
+	static std::uint64_t constexpr _COMP_MASK = (std::uint64_t(1) << _COMP_BITS) - 1;
+
+	//	An even number of steps so that 0 , and therefore the identity , is decoded exactly .
+	static std::uint64_t constexpr _COMP_MAX = _COMP_MASK - 1;
+	static double constexpr _RANGE = 0.70710678118654752440; // 1/sqrt(2)
+
+
+public:
+	static double constexpr MAX_ANGULAR_ERROR = 4.89897948556635619640 / _COMP_MAX; // 2*sqrt(6)/_COMP_MAX
+
+
+	Packed_UnitQuaternion() : Packed_UnitQuaternion( _encode(1.0, 0.0, 0.0, 0.0) ){}
+
+	template<class T>
+	Packed_UnitQuaternion(UnitQuaternion<T> const& uq)
+	:	Packed_UnitQuaternion(  _encode( uq.w(), uq.x(), uq.y(), uq.z() )  ){}
+
+
+	template<class T>
+	auto unit_qtn() const-> UnitQuaternion<T>
+	{
+		T q[4];
+
+		_decode(code(), q);
+
+		return Skipped< UnitQuaternion<T> >( Quaternion<T>(q[0], q[1], q[2], q[3]) );
+	}
+
+	template<class T>
+	operator UnitQuaternion<T>() const{  return unit_qtn<T>();  }
+
+
+	auto code() const-> std::uint64_t
+	{
+		if constexpr(BITS == 32)
+			return _code;
+		else
+			return std::uint64_t(_code[0]) | std::uint64_t(_code[1]) << 16 | std::uint64_t(_code[2]) << 32;
+	}
+
+
+private:
+	friend struct s3d::_Quaternion_Packing;
+
+
+	Selective_t< BITS == 32, std::uint32_t, std::uint16_t[3] > _code;
+
+
+	explicit Packed_UnitQuaternion(std::uint64_t const c)
+	{
+		if constexpr(BITS == 32)
+			_code = static_cast<std::uint32_t>(c);
+		else
+			for(size_t i = 0;  i < 3;  ++i)
+				_code[i] = static_cast<std::uint16_t>(c >> 16*i);
+	}
+
+
+	template<class T>
+	static auto _encode(T const w, T const x, T const y, T const z)-> std::uint64_t
+	{
+		T const q[4] = {w, x, y, z};
+
+		unsigned m = 0;
+
+		for(unsigned i = 1;  i < 4;  ++i)
+			if( std::abs(q[i]) > std::abs(q[m]) )
+				m = i;
+
+		T const sign = q[m] < 0 ? T(-1) : T(1);
+		std::uint64_t c = m;
+
+		for(unsigned i = 0;  i < 4;  ++i)
+			if(i != m)
+			{
+				//	rounds to the nearest step by truncating u + 1/2 .
+				double const
+					u = ( double(sign*q[i]) + _RANGE )/(2*_RANGE)*_COMP_MAX,
+					r = std::clamp( u + .5, 0.0, double(_COMP_MAX) );
+
+				c = c << _COMP_BITS | static_cast<std::uint64_t>(r);
+			}
+
+		return c;
+	}
+
+
+	template<class T>
+	static void _decode(std::uint64_t c, T (&q)[4])
+	{
+		unsigned const m = static_cast<unsigned>( c >> 3*_COMP_BITS & 3 );
+
+		T sqr_sum = 0;
+
+		for(unsigned i = 4;  i-- > 0;)
+			if(i != m)
+			{
+				q[i] = T( double(c & _COMP_MASK)/_COMP_MAX*(2*_RANGE) - _RANGE );
+				sqr_sum += q[i]*q[i];
+				c >>= _COMP_BITS;
+			}
+
+		q[m] = std::sqrt(  std::max( T(1) - sqr_sum, T(0) )  );
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+struct s3d::_Quaternion_Packing : Unconstructible
+{
+	template<size_t BITS, class T>
+	static auto encode(T const w, T const x, T const y, T const z)-> Packed_UnitQuaternion<BITS>
+	{
+		return Packed_UnitQuaternion<BITS>( Packed_UnitQuaternion<BITS>::_encode(w, x, y, z) );
+	}
+
+	template<size_t BITS, class T>
+	static void decode(Packed_UnitQuaternion<BITS> const& pq, T (&q)[4])
+	{
+		Packed_UnitQuaternion<BITS>::_decode(pq.code(), q);
+	}
+};
+
+
+//	Packs quaternions held in 4 lanes : w, x, y, z , which are expected to be normalized .
+template<std::size_t BITS, class POLICY, class T>
+auto s3d::encode_all(POLICY const& policy, PointSet<T, 4> const& qs)
+->	std::vector< Packed_UnitQuaternion<BITS> >
+{
+	std::vector< Packed_UnitQuaternion<BITS> > res( qs.size() );
+
+	T const* const Q[4] = {qs.lane_data(0), qs.lane_data(1), qs.lane_data(2), qs.lane_data(3)};
+
+	Parallel_for
+	(	policy, qs.size(), sizeof(T)
+	,	[&res, &Q](size_t const bi, size_t const ei)
+		{
+			for(size_t k = bi;  k < ei;  ++k)
+				res[k] = _Quaternion_Packing::encode<BITS>(Q[0][k], Q[1][k], Q[2][k], Q[3][k]);
+		}
+	);
+
+	return res;
+}
+
+
+template<class T, class POLICY, std::size_t BITS>
+auto s3d::decode_all(POLICY const& policy, std::vector< Packed_UnitQuaternion<BITS> > const& pqs)
+->	PointSet<T, 4>
+{
+	PointSet<T, 4> res( pqs.size() );
 
+	T* const Res[4] = {res.lane_data(0), res.lane_data(1), res.lane_data(2), res.lane_data(3)};
+
+	Parallel_for
+	(	policy, pqs.size(), sizeof(T)
+	,	[&Res, &pqs](size_t const bi, size_t const ei)
+		{
+			for(size_t k = bi;  k < ei;  ++k)
+			{
+				T q[4];
+
+				_Quaternion_Packing::decode(pqs[k], q);
+
+				_Lane_IO::store(q, Res, k);
+			}
+		}
+	);
+
+	return res;
+}
 
 #endif //  end of #ifndef _S3D_QUATERNION_
\ No newline at end of file
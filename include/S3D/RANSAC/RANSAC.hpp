@@ -0,0 +1,374 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_RANSAC_
+#define _S3D_RANSAC_
+
+
+#include "S3D/Decomposition/Decomposition.hpp"
+#include "S3D/Euclid/Euclid.hpp"
+#include "S3D/Parallel/Parallel.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace s3d
+{
+
+	//	RANSAC counts inliers , MSAC sums squared distances truncated at the inlier threshold .
+	enum class SAC_Mode{RANSAC, MSAC};
+
+
+	template<class PRIM, SAC_Mode MODE = SAC_Mode::MSAC>
+	class Sample_Consensus;
+
+
+	struct _Consensus_Kernel;
+
+}
+
+
+namespace s3d::flag
+{
+
+	//	for Sample_Consensus : probability of having drawn at least one sample free of outliers .
+	template<class T = float>
+	struct Confidence;
+
+	//	for Sample_Consensus : seed of the random sampling , so that fits can be reproduced .
+	struct Random_Seed;
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	class FLAG
+	,	Confidence, <FLAG>
+	);
+
+	template<class FLAG>
+	struct is_Random_Seed;
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+template<class T>
+struct s3d::flag::Confidence
+{
+	Confidence(T const p) : probability(p){}
+
+
+	T probability;
+};
+
+
+struct s3d::flag::Random_Seed
+{
+	Random_Seed(std::uint32_t const s) : seed(s){}
+
+
+	std::uint32_t seed;
+};
+
+
+template<class FLAG>
+struct s3d::flag::is_Random_Seed : is_Same< Decay_t<FLAG>, Random_Seed >{};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Consensus of all points with a plane or a line , fused into one pass over the coordinate
+*	lanes of PointSet by _Euclid_Batch::capped_sqr_dist_sum .
+*/
+struct s3d::_Consensus_Kernel : Unconstructible
+{
+	template<class T>
+	struct Score
+	{
+		size_t nof_inliers = 0;
+		T cost = std::numeric_limits<T>::infinity();  // sum of min(d^2, threshold^2)
+	};
+
+
+	template<class T, class PRIM>
+	static auto score(PointSet<T, 3> const& points, PRIM const& model, T const sqr_threshold)
+	->	Score<T>
+	{
+		auto const [cost, nof_inliers]
+		=	_Euclid_Batch::capped_sqr_dist_sum<_WIDTH>(points, model, sqr_threshold);
+
+		return {nof_inliers, cost};
+	}
+
+
+	template<class T, class PRIM>
+	static void inliers
+	(	PointSet<T, 3> const& points, PRIM const& model, T const sqr_threshold
+	,	std::vector<size_t>& res
+	)
+	{
+		T const *const x = points.lane_data(0),  *const y = points.lane_data(1),  *const z = points.lane_data(2);
+		auto const sqr_dist_f = _Euclid_Batch::sqr_dist_to(model);
+
+		res.clear();
+
+		for(size_t i = 0;  i < points.size();  ++i)
+			if( sqr_dist_f(x[i], y[i], z[i]) <= sqr_threshold )
+				res.push_back(i);
+	}
+
+
+private:
+	static size_t constexpr _WIDTH = 8;
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Fits a Plane<T, 3> or a Line<T, 3> to points with outliers . Hypotheses from random minimal
+*	samples are drawn in batches and scored in parallel , and the number of them to draw shrinks
+*	as the best inlier ratio so far grows , down to what flag::Confidence asks for . The best
+*	hypothesis is refined by the principal axes of the covariance of its inliers .
+*	Takes flag::Confidence , flag::Iteration_Cap ( the most hypotheses to draw ) and
+*	flag::Random_Seed . Results do not depend on the policy .
+*/
+template<class PRIM, s3d::SAC_Mode MODE>
+class s3d::Sample_Consensus
+{
+private:
+	using T = typename PRIM::value_type;
+
+public:
+	using model_t = PRIM;
+	using value_type = T;
+	static SAC_Mode constexpr mode = MODE;
+	static size_t constexpr SAMPLE_SIZE = trait::is_Plane<PRIM>::value ? 3 : 2;
+
+	static_assert
+	(	(trait::is_Plane<PRIM>::value || trait::is_Line<PRIM>::value) && PRIM::DIMENSION == 3
+	);
+
+
+	template<  class FS = Flag_Set<>, class = Enable_if_t< is_Flag_Set<FS>::value >  >
+	Sample_Consensus(T const inlier_threshold, FS&& fs = {}) : _threshold(inlier_threshold)
+	{
+		assert(_threshold > 0);
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Confidence, FS>::value)
+			_confidence = static_cast<T>( Satisfying_Flag<flag::is_Confidence>(fs).probability );
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Iteration_Cap, FS>::value)
+			_max_iterations = Satisfying_Flag<flag::is_Iteration_Cap>(fs).max_iterations;
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Random_Seed, FS>::value)
+			_seed = Satisfying_Flag<flag::is_Random_Seed>(fs).seed;
+	}
+
+
+	//	Null with less than SAMPLE_SIZE points or when every sample drawn was degenerate .
+	template<class POLICY>
+	auto fit(POLICY const& policy, PointSet<T, 3> const& points)-> Nullable<PRIM>
+	{
+		_inliers.clear(),  _nof_iterations = 0;
+
+		if(points.size() < SAMPLE_SIZE)
+			return Null_t{};
+
+		T const sqr_threshold = _threshold*_threshold;
+
+		std::mt19937 engine(_seed);
+		std::uniform_int_distribution<size_t> pick(0, points.size() - 1);
+
+		size_t nof_required = _max_iterations;
+		_Score_t best{};
+		Nullable<PRIM> best_model;
+
+		while(_nof_iterations < nof_required)
+		{
+			size_t const nof_draws = std::min(_BATCH_SIZE, nof_required - _nof_iterations);
+
+			_hypotheses.clear();
+
+			for(size_t h = 0;  h < nof_draws;  ++h)
+				if( auto const model = _hypothesis(points, engine, pick);  model.has_value() )
+					_hypotheses.push_back(model.v());
+
+			_nof_iterations += nof_draws;
+			_scores.resize( _hypotheses.size() );
+
+			Parallel_for
+			(	_per_hypothesis(policy), _hypotheses.size(), sizeof(_Score_t)
+			,	[this, &points, sqr_threshold](size_t const bi, size_t const ei)
+				{
+					for(size_t h = bi;  h < ei;  ++h)
+						_scores[h] = _Consensus_Kernel::score(points, _hypotheses[h], sqr_threshold);
+				}
+			);
+
+			//	in the order of drawing , so that ties are broken the same way under any policy .
+			for(size_t h = 0;  h < _hypotheses.size();  ++h)
+				if( _is_better(_scores[h], best) )
+					best = _scores[h],  best_model = _hypotheses[h];
+
+			if(best_model.has_value())
+				nof_required = _nof_required(best.nof_inliers, points.size());
+		}
+
+		if(!best_model.has_value())
+			return Null_t{};
+
+		_Consensus_Kernel::inliers(points, best_model.v(), sqr_threshold, _inliers);
+
+		if( auto const refined = _refined(points);  refined.has_value() )
+		{
+			best_model = refined;
+
+			_Consensus_Kernel::inliers(points, best_model.v(), sqr_threshold, _inliers);
+		}
+
+		return best_model;
+	}
+
+
+	//	Indices of the points within the inlier threshold of the last fitted model .
+	auto inliers() const-> std::vector<size_t> const&{  return _inliers;  }
+
+	//	Hypotheses drawn by the last fit , degenerate samples included .
+	auto nof_iterations() const-> size_t{  return _nof_iterations;  }
+
+
+private:
+	using _Score_t = _Consensus_Kernel::Score<T>;
+
+	static size_t constexpr _BATCH_SIZE = 64;
+
+	T _threshold;
+	T _confidence = T(.99);
+	size_t _max_iterations = 1000;
+	std::uint32_t _seed = 0;
+
+	std::vector<PRIM> _hypotheses{};
+	std::vector<_Score_t> _scores{};
+	std::vector<size_t> _inliers{};
+	size_t _nof_iterations = 0;
+
+
+	//	A batch holds far fewer hypotheses than a grain of points , so every one is a chunk .
+	template<class POLICY>
+	static auto _per_hypothesis(POLICY const& policy)
+	{
+		if constexpr( is_Same< Decay_t<POLICY>, Parallel_Policy >::value )
+			return Parallel_Policy{policy.nof_threads, 1};
+		else
+			return policy;
+	}
+
+
+	static auto _is_better(_Score_t const& s1, _Score_t const& s2)-> bool
+	{
+		if constexpr(MODE == SAC_Mode::RANSAC)
+			return
+			s1.nof_inliers > s2.nof_inliers || (s1.nof_inliers == s2.nof_inliers && s1.cost < s2.cost);
+		else
+			return s1.cost < s2.cost;
+	}
+
+
+	//	log(1 - confidence) / log(1 - w^s) with w the inlier ratio and s the sample size .
+	auto _nof_required(size_t const nof_inliers, size_t const nof_points) const-> size_t
+	{
+		double const
+			w = double(nof_inliers)/double(nof_points),
+			all_inliers = std::pow(w, double(SAMPLE_SIZE));
+
+		if( !(all_inliers > 0) || !(_confidence < 1) )
+			return _max_iterations;
+		else if(all_inliers >= 1)
+			return std::min<size_t>(_nof_iterations, _max_iterations);
+
+		double const n = std::ceil(  std::log( 1.0 - double(_confidence) ) / std::log(1.0 - all_inliers)  );
+
+		return n < double(_max_iterations) ? static_cast<size_t>( std::max(n, 1.0) ) : _max_iterations;
+	}
+
+
+	//	Null when the sample is degenerate : coincident points , or collinear ones for a plane .
+	static auto _hypothesis
+	(	PointSet<T, 3> const& points, std::mt19937& engine, std::uniform_int_distribution<size_t>& pick
+	)->	Nullable<PRIM>
+	{
+		size_t idx[SAMPLE_SIZE];
+
+		for(size_t s = 0;  s < SAMPLE_SIZE;  ++s)
+			for(bool drawn = false;  !drawn;  )
+			{
+				idx[s] = pick(engine),  drawn = true;
+
+				for(size_t k = 0;  k < s;  ++k)
+					drawn = drawn && idx[k] != idx[s];
+			}
+
+		Vector<T, 3> const p0 = points(idx[0]),  d1 = points(idx[1]) - p0;
+
+		if constexpr(trait::is_Plane<PRIM>::value)
+		{
+			Vector<T, 3> const d2 = points(idx[2]) - p0,  nml = d1.cross(d2);
+
+			if( !(  nml.norm() > std::sqrt( std::numeric_limits<T>::epsilon() )*d1.norm()*d2.norm()  ) )
+				return Null_t{};
+
+			return PRIM( p0, UnitVec<T, 3>(nml) );
+		}
+		else
+		{
+			if( !(d1.norm() > 0) )
+				return Null_t{};
+
+			return PRIM( p0, UnitVec<T, 3>(d1) );
+		}
+	}
+
+
+	//	Through the centroid of the inliers , normal to the least spread axis for a plane and
+	//	along the most spread one for a line .
+	auto _refined(PointSet<T, 3> const& points) const-> Nullable<PRIM>
+	{
+		if(_inliers.size() < SAMPLE_SIZE + 1)
+			return Null_t{};
+
+		Vector<T, 3> c = Vector<T, 3>::Zero();
+
+		for(auto const i : _inliers)
+			c += points(i);
+
+		c /= T( _inliers.size() );
+
+		Matrix<T, 3, 3> cov = Matrix<T, 3, 3>::Zero();
+
+		for(auto const i : _inliers)
+		{
+			Vector<T, 3> const d = points(i) - c;
+
+			cov += d*d.transpose();
+		}
+
+		Eigen_Decomposition const ed( cov, Flag_Set<flag::Real_Symmetric>{} );
+
+		//	eigenvalues come in increasing order .
+		Vector<T, 3> const axis = ed.eigenvec( trait::is_Plane<PRIM>::value ? 0 : 2 );
+
+		if( !(axis.norm() > 0) )
+			return Null_t{};
+
+		return PRIM( c, UnitVec<T, 3>(axis) );
+	}
+};
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#endif // end of #ifndef _S3D_RANSAC_
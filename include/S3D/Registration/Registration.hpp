@@ -0,0 +1,527 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_REGISTRATION_
+#define _S3D_REGISTRATION_
+
+
+#include "S3D/Affine/Affine.hpp"
+#include "S3D/Decomposition/Decomposition.hpp"
+#include "S3D/KdTree/KdTree.hpp"
+#include <chrono>
+#include <limits>
+#include <vector>
+
+
+namespace s3d
+{
+
+	enum class ICP_Mode{POINT_TO_POINT, POINT_TO_PLANE};
+
+
+	template<class T>
+	class Alignment_Accumulator;
+
+
+	template<class T>
+	struct ICP_Iteration_Stats;
+
+
+	template<class T, ICP_Mode MODE = ICP_Mode::POINT_TO_POINT>
+	class Iterative_Closest_Point;
+
+
+	struct _Rigid_Alignment;
+
+}
+
+
+namespace s3d::flag
+{
+
+	//	for Iterative_Closest_Point : pairs farther apart than this are left out of alignment .
+	template<class T = float>
+	struct Rejection_Distance;
+
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	class FLAG
+	,	Rejection_Distance, <FLAG>
+	);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+template<class T>
+struct s3d::flag::Rejection_Distance
+{
+	Rejection_Distance(T const dist) : distance(dist){}
+
+
+	T distance;
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Closed form alignment of corresponding pairs (p, q) streamed one by one : keeps only the count ,
+*	both centroids , the 3x3 cross covariance sum (p - pc)(q - qc)^T and the spread sum |p - pc|^2 ,
+*	updated around the running centroids so that far-off coordinates lose no precision .
+*	Accumulators over disjoint parts of the pairs merge into the one over all of them , which lets
+*	threads sum their own parts . rigid_transform is Kabsch and scalable_transform is Umeyama ,
+*	both from the SVD of the fixed size cross covariance , mapping p onto q .
+*/
+template<class T>
+class s3d::Alignment_Accumulator
+{
+public:
+	using value_type = T;
+
+	static_assert( trait::is_real<T>::value );
+
+
+	auto push(Vector<T, 3> const& p, Vector<T, 3> const& q)-> Alignment_Accumulator&
+	{
+		Vector<T, 3> const dp = p - _pc,  dq = q - _qc;
+
+		++_n;
+
+		_pc += dp/T(_n),  _qc += dq/T(_n);
+
+		_H += dp*( q - _qc ).transpose();
+		_spread += dp.dot(p - _pc);
+
+		return *this;
+	}
+
+
+	auto merge(Alignment_Accumulator const& acc)-> Alignment_Accumulator&
+	{
+		if(acc._n == 0)
+			return *this;
+		else if(_n == 0)
+			return *this = acc;
+
+		size_t const n = _n + acc._n;
+		T const w = T(_n)*T(acc._n)/T(n);
+		Vector<T, 3> const dp = acc._pc - _pc,  dq = acc._qc - _qc;
+
+		_H += acc._H + w*dp*dq.transpose();
+		_spread += acc._spread + w*dp.dot(dp);
+
+		_pc += T(acc._n)/T(n)*dp,  _qc += T(acc._n)/T(n)*dq;
+		_n = n;
+
+		return *this;
+	}
+
+
+	void clear(){  *this = Alignment_Accumulator{};  }
+
+	auto size() const-> size_t{  return _n;  }
+
+	auto source_centroid() const-> Vector<T, 3> const&{  return _pc;  }
+	auto target_centroid() const-> Vector<T, 3> const&{  return _qc;  }
+	auto cross_covariance() const-> Matrix<T, 3, 3> const&{  return _H;  }
+
+
+	//	Null with less than 3 pairs .
+	auto rigid_transform() const-> Nullable< Rigid_Body_Transform<T, 3> >
+	{
+		if(_n < 3)
+			return Null_t{};
+
+		auto const [R, sv] = _rotation();
+
+		return Rigid_Body_Transform<T, 3>( Rotation<T, 3>(R), Vector<T, 3>(_qc - R*_pc) );
+	}
+
+
+	//	Null with less than 3 pairs , or with all source points at the same place .
+	auto scalable_transform() const-> Nullable< Scalable_Body_Transform<T, 3> >
+	{
+		if(_n < 3 || !(_spread > 0))
+			return Null_t{};
+
+		auto const [R, sv] = _rotation();
+		T const scale = sv/_spread;
+
+		return Scalable_Body_Transform<T, 3>( R, Vector<T, 3>(_qc - scale*R*_pc), scale );
+	}
+
+
+private:
+	size_t _n = 0;
+	Vector<T, 3> _pc = Vector<T, 3>::Zero(),  _qc = Vector<T, 3>::Zero();
+	Matrix<T, 3, 3> _H = Matrix<T, 3, 3>::Zero();
+	T _spread = 0;
+
+
+	//	The rotation with the sum of singular values it is signed by .
+	auto _rotation() const-> std::pair< Matrix<T, 3, 3>, T >
+	{
+		Singular_Value_Decomposition const svd(_H);
+
+		Matrix<T, 3, 3> const U = svd.Umat(),  V = svd.Vmat();
+		Matrix<T, 3, 3> D = Matrix<T, 3, 3>::identity();
+
+		//	a reflection is turned into the nearest rotation .
+		D(2, 2) = (V*U.transpose()).det() < 0 ? T(-1) : T(1);
+
+		return
+		{	V*D*U.transpose()
+		,	svd.singularval(0) + svd.singularval(1) + D(2, 2)*svd.singularval(2)
+		};
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+template<class T>
+struct s3d::ICP_Iteration_Stats
+{
+	size_t nof_correspondences = 0;
+	T rms_residual = 0;  // residuals are point distances , or distances to tangent planes
+	T max_residual = 0;
+	std::chrono::nanoseconds correspondence_time{0};
+	std::chrono::nanoseconds alignment_time{0};
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Rigid motions best aligning matched pairs of moved source points and target points .
+*	Pairs are given by matches , whose entries with index out of the target are left out .
+*/
+struct s3d::_Rigid_Alignment : Unconstructible
+{
+	/**	Kabsch over partial sums of parts of PART_SIZE pairs , which are merged in index order so
+	*	that the result depends neither on the policy nor on which thread finishes first .
+	*	parts is a workspace kept by the caller .
+	*/
+	template<class POLICY, class T>
+	static auto point_to_point
+	(	POLICY const& policy, PointSet<T, 3> const& moved, PointSet<T, 3> const& target
+	,	std::vector< Neighbor<T> > const& matches, std::vector< Alignment_Accumulator<T> >& parts
+	)->	Nullable< Rigid_Body_Transform<T, 3> >
+	{
+		size_t const nof_pairs = matches.size();
+
+		parts.assign( (nof_pairs + PART_SIZE - 1) / PART_SIZE, Alignment_Accumulator<T>{} );
+
+		Parallel_for
+		(	_per_part(policy), parts.size(), sizeof(Alignment_Accumulator<T>)
+		,	[&](size_t const bp, size_t const ep)
+			{
+				for(size_t p = bp;  p < ep;  ++p)
+					for
+					(	size_t i = p*PART_SIZE, ei = std::min(nof_pairs, i + PART_SIZE)
+					;	i < ei
+					;	++i
+					)
+						if(matches[i].index < target.size())
+							parts[p].push( moved(i), target(matches[i].index) );
+			}
+		);
+
+		Alignment_Accumulator<T> acc;
+
+		for(auto const& part : parts)
+			acc.merge(part);
+
+		return acc.rigid_transform();
+	}
+
+
+	/**	Linearizes the rotation as p + w X p to minimize the sum of ( n.(p + w X p + t - q) )^2 ,
+	*	whose normal equations over x = (w, t) are 6x6 : sum a a^T x = sum a n.(q - p) with
+	*	a = ( p X n, n ) .
+	*/
+	template<class T>
+	static auto point_to_plane
+	(	PointSet<T, 3> const& moved, PointSet<T, 3> const& target, PointSet<T, 3> const& normals
+	,	std::vector< Neighbor<T> > const& matches
+	)->	Nullable< Rigid_Body_Transform<T, 3> >
+	{
+		Matrix<T, 6, 6> AtA = Matrix<T, 6, 6>::Zero();
+		Vector<T, 6> Atb = Vector<T, 6>::Zero();
+		size_t n = 0;
+
+		for(size_t i = 0;  i < matches.size();  ++i)
+		{
+			if(matches[i].index >= target.size())
+				continue;
+
+			Vector<T, 3> const
+				p = moved(i),  q = target(matches[i].index),  nml = normals(matches[i].index),
+				pxn = p.cross(nml);
+
+			T const a[6] = {pxn(0), pxn(1), pxn(2), nml(0), nml(1), nml(2)};
+			T const b = nml.dot(q - p);
+
+			for(size_t r = 0;  r < 6;  ++r)
+			{
+				for(size_t c = r;  c < 6;  ++c)
+					AtA(r, c) += a[r]*a[c];
+
+				Atb(r) += a[r]*b;
+			}
+
+			++n;
+		}
+
+		if(n < 6)
+			return Null_t{};
+
+		for(size_t r = 1;  r < 6;  ++r)
+			for(size_t c = 0;  c < r;  ++c)
+				AtA(r, c) = AtA(c, r);
+
+		Vector<T, 6> const x = Least_Square_Problem::solution(AtA, Atb);
+		Vector<T, 3> const w{x(0), x(1), x(2)},  t{x(3), x(4), x(5)};
+		T const theta = w.norm();
+
+		if( theta > std::sqrt(std::numeric_limits<T>::epsilon()) )
+			return Rigid_Body_Transform<T, 3>( Rotation<T, 3>(UnitVec<T, 3>(w), theta), t );
+
+		//	too small an angle to have an axis : first order rotation I + [w]x instead .
+		return
+		Rigid_Body_Transform<T, 3>
+		(	Rotation<T, 3>( Matrix<T, 3, 3>(Matrix<T, 3, 3>::identity() + w.skew()) ), t
+		);
+	}
+
+
+	static size_t constexpr PART_SIZE = 64;
+
+
+private:
+	//	grain_size counts pairs , while chunks are made of parts .
+	template<class POLICY>
+	static auto _per_part(POLICY const& policy)-> POLICY
+	{
+		if constexpr( is_Same<POLICY, Parallel_Policy>::value )
+			return 
+			Parallel_Policy{ policy.nof_threads, std::max<size_t>(policy.grain_size/PART_SIZE, 1) };
+		else
+			return policy;
+	}
+};
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Registers a source point set onto a target point set by iterating two steps : every moved
+*	source point is matched with its nearest target point , and then the rigid motion best
+*	aligning the pairs is composed into the result . POINT_TO_PLANE takes unit normals of target .
+*	Takes flag::Tolerance ( relative change of rms_residual to stop at , or no change beyond
+*	rounding errors of target coordinates ) , flag::Iteration_Cap
+*	and flag::Rejection_Distance . Buffers are kept between iterations and calls , and PAR runs
+*	on the workers _Thread_Pool keeps asleep between calls , so that an iteration allocates 
+*	nothing once the first one is done .
+*/
+template<class T, s3d::ICP_Mode MODE>
+class s3d::Iterative_Closest_Point
+{
+public:
+	using value_type = T;
+	static ICP_Mode constexpr mode = MODE;
+
+	static_assert( trait::is_real<T>::value );
+
+
+	template
+	<	class POLICY, class FS = Flag_Set<>
+	,	class = Enable_if_t< trait::is_Execution_Policy<POLICY>::value && is_Flag_Set<FS>::value >
+	>
+	Iterative_Closest_Point(POLICY const& policy, PointSet<T, 3> const& target, FS&& fs = {})
+	:	_target(target), _tree(policy, _target)
+	{
+		static_assert(MODE == ICP_Mode::POINT_TO_POINT, "POINT_TO_PLANE needs normals of target .");
+
+		_set_flags(fs);
+	}
+
+	template
+	<	class POLICY, class FS = Flag_Set<>
+	,	class = Enable_if_t< trait::is_Execution_Policy<POLICY>::value && is_Flag_Set<FS>::value >
+	>
+	Iterative_Closest_Point
+	(	POLICY const& policy, PointSet<T, 3> const& target, PointSet<T, 3> const& target_normals
+	,	FS&& fs = {}
+	)
+	:	_target(target), _normals(target_normals), _tree(policy, _target)
+	{
+		static_assert(MODE == ICP_Mode::POINT_TO_PLANE);
+
+		assert( _normals.size() == _target.size() );
+
+		_set_flags(fs);
+	}
+
+
+	//	The rigid motion moving source onto target , starting from initial .
+	//	An empty target has nothing to match with , so that initial is returned without iterating .
+	template<class POLICY>
+	auto align
+	(	POLICY const& policy, PointSet<T, 3> const& source
+	,	Rigid_Body_Transform<T, 3> const& initial = {}
+	)->	Rigid_Body_Transform<T, 3>
+	{
+		using clock_t = std::chrono::steady_clock;
+
+		Rigid_Body_Transform<T, 3> res = initial;
+
+		_stats.clear(),  _converged = false;
+		_matches.resize(source.size());
+
+		if(_target.size() == 0)
+			return res;
+
+		T const max_sqr_dist = _rejection_distance*_rejection_distance;
+
+		while(_stats.size() < _max_iterations)
+		{
+			ICP_Iteration_Stats<T> stats;
+
+			auto const t0 = clock_t::now();
+
+			_moved = source;
+
+			transform_all(policy, _moved, res);
+
+			Parallel_for
+			(	policy, _moved.size(), sizeof(Neighbor<T>)
+			,	[this, max_sqr_dist](size_t const bi, size_t const ei)
+				{
+					for(size_t i = bi;  i < ei;  ++i)
+					{
+						Neighbor<T> const nb = _tree.nearest( _moved(i) ).v();
+
+						_matches[i] = nb.sqr_dist <= max_sqr_dist ? nb : Neighbor<T>{_target.size(), nb.sqr_dist};
+					}
+				}
+			);
+
+			auto const t1 = clock_t::now();
+
+			_residual_stats(stats);
+
+			auto const step = _step(policy);
+
+			if(step.has_value())
+				res = res >> step.v();
+
+			stats.correspondence_time = t1 - t0,  stats.alignment_time = clock_t::now() - t1;
+
+			_stats.push_back(stats);
+
+			if(!step.has_value())
+				break;
+
+			if(_stats.size() > 1)
+			{
+				T const prev_rms = _stats[_stats.size() - 2].rms_residual;
+
+				if( std::abs(prev_rms - stats.rms_residual) <= _tolerance*prev_rms + _rounding_floor )
+				{
+					_converged = true;
+
+					break;
+				}
+			}
+		}
+
+		return res;
+	}
+
+
+	//	How each iteration of the last align went , residuals measured before its own step .
+	auto stats() const-> std::vector< ICP_Iteration_Stats<T> > const&{  return _stats;  }
+
+	auto converged() const-> bool{  return _converged;  }
+
+
+private:
+	PointSet<T, 3> _target, _normals;
+	KdTree<T, 3> _tree;
+
+	T _tolerance = std::sqrt( std::numeric_limits<T>::epsilon() );
+	T _rounding_floor = 0;  // residuals stop changing by more than rounding errors around target
+	size_t _max_iterations = 50;
+	T _rejection_distance = std::numeric_limits<T>::infinity();
+
+	PointSet<T, 3> _moved{};
+	std::vector< Neighbor<T> > _matches{};
+	std::vector< Alignment_Accumulator<T> > _parts{};
+	std::vector< ICP_Iteration_Stats<T> > _stats{};
+	bool _converged = false;
+
+
+	template<class FS>
+	void _set_flags(FS const& fs)
+	{
+		if constexpr(Has_Satisfying_Flag<flag::is_Tolerance, FS>::value)
+			_tolerance = static_cast<T>( Satisfying_Flag<flag::is_Tolerance>(fs).tolerance );
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Iteration_Cap, FS>::value)
+			_max_iterations = Satisfying_Flag<flag::is_Iteration_Cap>(fs).max_iterations;
+
+		if constexpr(Has_Satisfying_Flag<flag::is_Rejection_Distance, FS>::value)
+			_rejection_distance
+			=	static_cast<T>( Satisfying_Flag<flag::is_Rejection_Distance>(fs).distance );
+
+		_stats.reserve(_max_iterations);
+
+		T radius = 0;
+
+		for(size_t i = 0;  i < _target.size();  ++i)
+			radius = std::max( radius, _target(i).norm() );
+
+		_rounding_floor = T(8)*std::numeric_limits<T>::epsilon()*radius;
+	}
+
+
+	template<class POLICY>
+	auto _step(POLICY const& policy)-> Nullable< Rigid_Body_Transform<T, 3> >
+	{
+		if constexpr(MODE == ICP_Mode::POINT_TO_POINT)
+			return _Rigid_Alignment::point_to_point(policy, _moved, _target, _matches, _parts);
+		else
+			return _Rigid_Alignment::point_to_plane(_moved, _target, _normals, _matches);
+	}
+
+
+	void _residual_stats(ICP_Iteration_Stats<T>& stats) const
+	{
+		T sum = 0;
+
+		for(size_t i = 0;  i < _matches.size();  ++i)
+		{
+			if(_matches[i].index >= _target.size())
+				continue;
+
+			T sqr_residual = _matches[i].sqr_dist;
+
+			if constexpr(MODE == ICP_Mode::POINT_TO_PLANE)
+			{
+				size_t const j = _matches[i].index;
+				T const r = _normals(j).dot( _moved(i) - _target(j) );
+
+				sqr_residual = r*r;
+			}
+
+			sum += sqr_residual,  ++stats.nof_correspondences;
+			stats.max_residual = std::max( stats.max_residual, std::sqrt(sqr_residual) );
+		}
+
+		if(stats.nof_correspondences > 0)
+			stats.rms_residual = std::sqrt( sum/T(stats.nof_correspondences) );
+	}
+};
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#endif // end of #ifndef _S3D_REGISTRATION_
@@ -0,0 +1,163 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#ifndef _S3D_SPARSE_
+#define _S3D_SPARSE_
+
+
+#include "S3D/Hamilton/Hamilton.hpp"
+#include <vector>
+
+
+namespace s3d
+{
+
+	template<class T, Storing_Order STOR = DefaultStorOrder>
+	class SparseMat;
+
+
+	template<class T, Storing_Order STOR>
+	struct _Seed_SparseMat;
+
+
+	template<class SPM>
+	static decltype(auto) _SpMat_implementor(SPM&& m);
+
+}
+
+
+namespace s3d::trait
+{
+
+	SGM_USER_DEFINED_TYPE_CHECK
+	(	SGM_MACROPACK(class T, Storing_Order STOR)
+	,	SparseMat, <T, STOR>
+	);
+
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+namespace s3d
+{
+
+	template<class SPM>
+	decltype(auto) _SpMat_implementor(SPM&& m)
+	{
+		using impl_t = typename Decay_t<SPM>::_impl_t;
+		using res_t = Selective_t< is_immutable<SPM>::value, impl_t const, impl_t >&;
+
+		return static_cast<res_t>(m._impl);
+	}
+
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+/**	Compressed sparse matrix which stores only its nonzero entries .
+*	It is deliberately not given the Matrix interface ( operator()(i, j) ) so that it never
+*	slips into an algorithm that would densify it , and dense() should be called explicitly
+*	when a dense Matrix is wanted .
+*/
+template<class T, s3d::Storing_Order STOR>
+class s3d::SparseMat
+{
+private:
+	template<class SPM>
+	friend decltype(auto) s3d::_SpMat_implementor(SPM&& m);
+
+	using _Seed_t = _Seed_SparseMat<T, STOR>;
+	using _impl_t = typename _Seed_t::egn_SpMat_t;
+
+	_impl_t _impl;
+
+
+public:
+	static_assert(trait::is_complexible<T>::value);
+
+	using value_type = T;
+	static size_t constexpr STT_ROW_SIZE = DYNAMIC, STT_COL_SIZE = DYNAMIC;
+	static Storing_Order constexpr STORING_ORDER = STOR;
+
+
+	struct Entry{  size_t row, col;  T value;  };
+
+
+	SparseMat() = default;
+	SparseMat(size_t const r, size_t const c) : _impl( _Seed_t::empty(r, c) ){}
+
+	//	Entries at the same position are summed up .
+	template
+	<	class CON
+	,	class = Enable_if_t<  is_Same< Decay_t< trait::Deref_t<CON> >, Entry >::value  >
+	>
+	SparseMat(size_t const r, size_t const c, CON const& entries)
+	:	_impl( _Seed_t::from_entries(r, c, entries) ){}
+
+	SparseMat(size_t const r, size_t const c, std::initializer_list<Entry>&& iL)
+	:	_impl( _Seed_t::from_entries(r, c, iL) ){}
+
+	//	Entries whose magnitudes are not greater than the cutoff are dropped .
+	template<  class MAT, class = Enable_if_t< trait::Has_Matrix_interface<MAT>::value >  >
+	explicit SparseMat(MAT const& m, T const cutoff = T(0))
+	:	_impl( _Seed_t::from_dense(_Mat_implementor(m), cutoff) ){}
+
+
+	auto rows() const-> size_t{  return _impl.rows();  }
+	auto cols() const-> size_t{  return _impl.cols();  }
+	auto nof_nonzeros() const-> size_t{  return _impl.nonZeros();  }
+
+	auto coeff(size_t const i, size_t const j) const-> T
+	{
+		assert(i < rows() && j < cols());
+
+		return _impl.coeff(i, j);
+	}
+
+	auto dense() const-> DynamicMat<T, STOR>{  return _MatrixAdaptor<T, DYNAMIC, DYNAMIC, STOR>(_impl);  }
+
+
+	auto transpose() const-> SparseMat{  return SparseMat(_ExemptionTag{}, _impl.transpose());  }
+
+
+	template<  class MAT, class = Enable_if_t< trait::Has_Matrix_interface<MAT>::value >  >
+	auto operator*(MAT const& m) const
+	->	Matrix< T, DYNAMIC, Decay_t<MAT>::STT_COL_SIZE, Storing_Order::COL_FIRST >
+	{
+		assert( cols() == m.rows() );
+
+		return _MatrixAdaptor< T, DYNAMIC, Decay_t<MAT>::STT_COL_SIZE, Storing_Order::COL_FIRST >
+		(	_impl*_Mat_implementor(m)
+		);
+	}
+
+	auto operator*(SparseMat const& spm) const-> SparseMat
+	{
+		assert( cols() == spm.rows() );
+
+		return SparseMat(_ExemptionTag{}, _impl*spm._impl);
+	}
+
+	auto operator*(T const s) const-> SparseMat{  return SparseMat(_ExemptionTag{}, _impl*s);  }
+
+
+private:
+	template<class Q>
+	SparseMat(_ExemptionTag, Q&& q) : _impl( Forward<Q>(q) ){}
+};
+
+
+template<class T, s3d::Storing_Order STOR>
+static auto operator*(T const s, s3d::SparseMat<T, STOR> const& spm)
+->	s3d::SparseMat<T, STOR>{  return spm*s;  }
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "_Sparse_by_Eigen.hpp"
+
+
+#endif // end of #ifndef _S3D_SPARSE_
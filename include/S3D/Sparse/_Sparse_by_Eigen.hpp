@@ -0,0 +1,57 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#include "Eigen/Sparse"
+
+
+template<class T, s3d::Storing_Order STOR>
+struct s3d::_Seed_SparseMat : Unconstructible
+{
+	using egn_SpMat_t
+	=	Eigen::SparseMatrix
+		<	T, STOR == Storing_Order::COL_FIRST ? Eigen::ColMajor : Eigen::RowMajor
+		>;
+
+
+	static auto empty(size_t const r, size_t const c)-> egn_SpMat_t
+	{
+		return egn_SpMat_t( static_cast<Eigen::Index>(r), static_cast<Eigen::Index>(c) );
+	}
+
+
+	template<class CON>
+	static auto from_entries(size_t const r, size_t const c, CON const& entries)-> egn_SpMat_t
+	{
+		using idx_t = typename egn_SpMat_t::StorageIndex;
+
+		std::vector< Eigen::Triplet<T, idx_t> > triplets;
+
+		triplets.reserve( Size(entries) );
+
+		for(auto const& e : entries)
+		{
+			assert(e.row < r && e.col < c);
+
+			triplets.emplace_back( static_cast<idx_t>(e.row), static_cast<idx_t>(e.col), e.value );
+		}
+
+		egn_SpMat_t res = empty(r, c);
+
+		res.setFromTriplets( triplets.begin(), triplets.end() );
+
+		return res;
+	}
+
+
+	template<class EMAT>
+	static auto from_dense(EMAT const& m, T const cutoff)-> egn_SpMat_t
+	{
+		egn_SpMat_t res = m.sparseView( T(1), std::abs(cutoff) );
+
+		return res.makeCompressed(),  res;
+	}
+};
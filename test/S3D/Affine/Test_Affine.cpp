@@ -230,6 +230,168 @@ static void Euler_Angles()
 
 		::_identical(Rz*Ry*Rx, A, B);
 }
+
+
+static void Cached_Ortho_Matrix()
+{
+	Vector<float, 3> const v{1, -2, 3};
+
+	auto sandwich_f
+	=	[&v](s3d::UnitQuaternion<float> const& q)-> Vector<float, 3>
+		{
+			return ( q*s3d::Quaternion<float>(0, v)*q.inv() ).v();
+		};
+
+	s3d::Rotation<float, 3> rot(UnitVec<float, 3>{1, 2, 3}, Pi/3.f);
+
+	::_identical( rot(v), sandwich_f(rot.cunit_qtn()) );
+
+	s3d::UnitQuaternion<float> const q = s3d::Rotation<float, 3>(Pi/5.f, -Pi/7.f, Pi/8.f).cunit_qtn();
+
+	{
+		auto& uqtn = rot.unit_qtn();
+
+		uqtn = q;
+	}
+
+	::_identical( rot(v), sandwich_f(q) );
+	::_identical( rot.cortho_mat()*rot.cortho_mat().transpose(), Matrix<float, 3, 3>::identity() );
+
+	s3d::Cached_Rotation const cached = rot;
+
+	::_identical( cached(v), rot(v) );
+	::_identical( cached.cortho_mat(), rot.cortho_mat() );
+	::_identical( cached.inv()(cached(v)), v );
+	::_identical( cached.rotate(rot)(v), rot.rotate(rot)(v) );
+
+	rot.spin_vec() = Vector<float, 3>{0.f, 0.f, Pi/2.f};
+
+	::_identical( rot(v), Vector<float, 3>{2.f, 1.f, 3.f} );
+
+	rot.ortho_mat() = OrthogonalMat<float, 3>::identity();
+
+	::_identical( rot(v), v );
+}
+
+
+static void Literal_Rotation()
+{
+	static auto constexpr q = s3d::LiteralQuaternion<double>::Euler_angles(Pi/5, Pi/7, Pi/8);
+	static s3d::LiteralMat<double, 3, 3> constexpr R = q.ortho_mat();
+	static s3d::Rotation<double, 2> constexpr rot2d(Pi/6);
+
+	static_assert(rot2d.angle() == Pi/6 && rot2d.inv().angle() == -Pi/6);
+
+	s3d::Rotation<double, 3> const
+		rot1(Pi/5, Pi/7, Pi/8),
+		rot2( s3d::Skipped< s3d::UnitQuaternion<double> >(q) ),
+		rot3(R);
+
+	::_identical( rot1.cortho_mat(), rot2.cortho_mat(), rot3.cortho_mat(), Matrix<double, 3, 3>(R) );
+	::_identical( rot2d.cortho_mat(), s3d::Rotation<double, 2>(Pi/6).cortho_mat() );
+}
+
+
+static void Transfer_on_View()
+{
+	float buffer[] = {1, 9, -2, 9, 3, 9};
+
+	s3d::MatrixView<float, 3, 1> point(buffer, 3, 1, 3, 2);
+	Vector<float, 3> const copied = point;
+
+	auto const rbt = s3d::Afn<float, 3>.rotate( UnitVec<float, 3>{1, -2, 3}, .15f ).translate(1.f, 2.f, 3.f);
+	s3d::Affine_Transform<float, 3> const afn(rbt);
+
+	::_identical(point >> afn, copied >> afn);
+	::_identical(point >> rbt, copied >> rbt);
+	::_identical( rbt.rotator()(point), rbt.rotator()(copied) );
+
+	point >>= afn;
+
+	::_identical( Vector<float, 3>{buffer[0], buffer[2], buffer[4]}, copied >> afn );
+	SGM_H2U_ASSERT(buffer[1] == 9 && buffer[3] == 9 && buffer[5] == 9);
+}
+
+
+static void Batch_Transfer()
+{
+	std::vector<Vector<float, 3>> const points
+	{	Vector<float, 3>{1, 0, 0}
+	,	Vector<float, 3>{0, 2, 0}
+	,	Vector<float, 3>{0, 0, 3}
+	,	Vector<float, 3>{1, 2, 3}
+	};
+
+	auto const sbtr
+	=	s3d::Afn<float, 3>
+		.	rotate(UnitVec<float, 3>{1, 1, 1}, Pi*2.f/3.f)
+		.	translate(1, -1, 2)
+		.	scale(2);
+
+	{
+		s3d::PointSet<float, 3> ps = points;
+
+		ps >>= sbtr;
+
+		for(size_t idx = 0;  idx < points.size();  ++idx)
+			::_identical( ps(idx), points.at(idx) >> sbtr );
+	}
+	{
+		s3d::PointSet<float, 3> const ps = points;
+		auto const ps2 = ps >> sbtr;
+
+		static_assert(std::is_same_v< decltype(ps2), s3d::PointSet<float, 3> const >);
+
+		::_identical( ps2(3), points.at(3) >> sbtr );
+		::_identical( ps(3), points.at(3) );
+	}
+	{
+		auto iterable = points;
+
+		iterable >>= sbtr;
+
+		for(size_t idx = 0;  idx < points.size();  ++idx)
+			::_identical( iterable.at(idx), points.at(idx) >> sbtr );
+	}
+}
+
+
+static void Parallel_Transfer()
+{
+	std::vector< Vector<float, 3> > points;
+
+	for(size_t idx = 0;  idx < 1000;  ++idx)
+		points.push_back( Vector<float, 3>{idx/1000.f, 1.f, -(idx/1000.f)} );
+
+	auto const rbtr 
+	=	s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, 2, 3}, Pi/3.f).translate(0, 1, 2);
+
+	s3d::Parallel_Policy const policy{4, 16};
+
+	{
+		auto iterable = points;
+
+		s3d::transform_all(policy, iterable, rbtr);
+
+		for(size_t idx = 0;  idx < points.size();  ++idx)
+			::_identical( iterable.at(idx), points.at(idx) >> rbtr );
+	}
+	{
+		s3d::PointSet<float, 3> ps = points;
+
+		s3d::transform_all(policy, ps, rbtr);
+
+		for(size_t idx = 0;  idx < points.size();  ++idx)
+			::_identical( ps(idx), points.at(idx) >> rbtr );
+	}
+	{
+		auto iterable = points;
+
+		s3d::transform_all(s3d::SEQ, iterable, rbtr);
+
+		::_identical( iterable.at(999), points.at(999) >> rbtr );
+	}
+}
 //========//========//========//========//=======#//========//========//========//========//=======#
 
 
@@ -239,4 +401,9 @@ SGM_HOW2USE_TESTS(s3d::spec::Test_, Affine, /**/)
 ,	::Composition_and_Transfer_2
 ,	::Reflection
 ,	::Euler_Angles
+,	::Cached_Ortho_Matrix
+,	::Literal_Rotation
+,	::Transfer_on_View
+,	::Batch_Transfer
+,	::Parallel_Transfer
 };
\ No newline at end of file
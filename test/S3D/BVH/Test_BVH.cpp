@@ -0,0 +1,193 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Test_BVH.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+using s3d::Vector;
+using s3d::UnitVec;
+using s3d::Neighbor;
+
+
+static auto _random_vec(std::mt19937& engine, float const range)-> Vector<float, 3>
+{
+	std::uniform_real_distribution<float> dist(-range, range);
+
+	return {dist(engine), dist(engine), dist(engine)};
+}
+
+
+//	Nearest answers of a linear scan over prims .
+template<class PRIM>
+static auto _scan(std::vector<PRIM> const& prims, Vector<float, 3> const& q)
+->	std::vector< Neighbor<float> >
+{
+	std::vector< Neighbor<float> > res;
+
+	for(size_t i = 0;  i < prims.size();  ++i)
+		res.push_back({  i, static_cast<float>( s3d::sqrDistance(q, prims[i]) )  });
+
+	std::sort
+	(	res.begin(), res.end()
+	,	[](Neighbor<float> const& n1, Neighbor<float> const& n2){  return n1.sqr_dist < n2.sqr_dist;  }
+	);
+
+	return res;
+}
+
+
+template<class PRIM>
+static void _same_as_scan(std::vector<PRIM> const& prims, std::mt19937& engine)
+{
+	s3d::BVH const bvh(prims);
+
+	SGM_H2U_ASSERT( bvh.size() == prims.size() );
+
+	for(size_t n = 0;  n < 50;  ++n)
+	{
+		Vector<float, 3> const q = ::_random_vec(engine, 12.f);
+		auto const answers = ::_scan(prims, q);
+
+		{
+			auto const nearest = bvh.nearest(q);
+
+			SGM_H2U_ASSERT
+			(	nearest.has_value() && nearest.v().index == answers[0].index
+			&&	nearest.v().sqr_dist == answers[0].sqr_dist
+			);
+		}
+		{
+			size_t constexpr k = 7;
+
+			auto const knn = bvh.nearest(q, k);
+
+			SGM_H2U_ASSERT( knn.size() == k );
+
+			for(size_t i = 0;  i < k;  ++i)
+				SGM_H2U_ASSERT( knn[i].index == answers[i].index );
+		}
+		{
+			float const radius = std::sqrt(answers[prims.size()/10].sqr_dist);
+
+			auto const found = bvh.within(q, radius);
+
+			size_t const nof_answers
+			=	std::count_if
+				(	answers.begin(), answers.end()
+				,	[radius](Neighbor<float> const& a){  return a.sqr_dist <= radius*radius;  }
+				);
+
+			SGM_H2U_ASSERT( found.size() == nof_answers );
+
+			for(size_t i = 0;  i < found.size();  ++i)
+				SGM_H2U_ASSERT( found[i].sqr_dist == answers[i].sqr_dist );
+		}
+	}
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Empty_Hierarchy()
+{
+	s3d::BVH< Vector<float, 3> > const bvh( std::vector< Vector<float, 3> >{} );
+
+	SGM_H2U_ASSERT( bvh.empty() && bvh.nof_nodes() == 0 );
+	SGM_H2U_ASSERT( !bvh.nearest(Vector<float, 3>::Zero()).has_value() );
+	SGM_H2U_ASSERT( bvh.nearest(Vector<float, 3>::Zero(), 3).empty() );
+	SGM_H2U_ASSERT( bvh.within(Vector<float, 3>::Zero(), 1.f).empty() );
+}
+
+
+static void Nearest_Points()
+{
+	std::mt19937 engine(2026);
+	std::vector< Vector<float, 3> > points;
+
+	for(size_t i = 0;  i < 2000;  ++i)
+		points.push_back( ::_random_vec(engine, 10.f) );
+
+	::_same_as_scan(points, engine);
+
+	{
+		s3d::BVH const bvh(points);
+
+		auto const nearest = bvh.nearest(points[123]);
+
+		SGM_H2U_ASSERT( nearest.v().index == 123 && nearest.v().sqr_dist == 0 );
+	}
+	{
+		//	degenerate sets : all on a line , or all at the same place .
+		std::vector< Vector<float, 3> > collinear, coincident;
+
+		for(size_t i = 0;  i < 500;  ++i)
+			collinear.push_back( Vector<float, 3>{float(i), 0.f, 0.f} ),
+			coincident.push_back( Vector<float, 3>{1.f, 2.f, 3.f} );
+
+		s3d::BVH const bvh1(collinear),  bvh2(coincident);
+
+		SGM_H2U_ASSERT( bvh1.nearest(Vector<float, 3>{41.2f, 3.f, -1.f}).v().index == 41 );
+		SGM_H2U_ASSERT( bvh2.within(Vector<float, 3>{1.f, 2.f, 3.5f}, 1.f).size() == 500 );
+	}
+}
+
+
+static void Nearest_Planes()
+{
+	std::mt19937 engine(20261017);
+	std::vector< s3d::Plane<float, 3> > planes;
+
+	for(size_t i = 0;  i < 2000;  ++i)
+		planes.emplace_back( ::_random_vec(engine, 10.f), UnitVec<float, 3>(::_random_vec(engine, 1.f)) );
+
+	::_same_as_scan(planes, engine);
+
+	{
+		s3d::BVH const bvh(planes);
+
+		auto const& P = planes[77];
+		Vector<float, 3> const q = P.position() + 3.f*P.normal().vec();
+
+		//	a plane and the same one with the normal flipped are the same primitive .
+		s3d::BVH const flipped
+		(	std::vector{P, s3d::Plane<float, 3>(P.position(), -P.normal())}
+		);
+
+		SGM_H2U_ASSERT( bvh.nearest(P.position()).v().index == 77 );
+		SGM_H2U_ASSERT( flipped.within(q, 3.01f).size() == 2 && flipped.within(q, 2.99f).empty() );
+	}
+}
+
+
+static void Nearest_Lines()
+{
+	std::mt19937 engine(17);
+	std::vector< s3d::Line<float, 3> > lines;
+
+	for(size_t i = 0;  i < 2000;  ++i)
+		lines.emplace_back( ::_random_vec(engine, 10.f), UnitVec<float, 3>(::_random_vec(engine, 1.f)) );
+
+	::_same_as_scan(lines, engine);
+
+	{
+		s3d::BVH const bvh(lines);
+
+		auto const& L = lines[500];
+
+		SGM_H2U_ASSERT( bvh.nearest(L.position() + 5.f*L.tangent().vec()).v().index == 500 );
+	}
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, BVH, /**/)
+{	::Empty_Hierarchy
+,	::Nearest_Points
+,	::Nearest_Planes
+,	::Nearest_Lines
+};
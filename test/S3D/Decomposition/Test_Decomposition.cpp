@@ -18,6 +18,14 @@ static void _identical(TYPES...types)
 {
 	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_Hamilton_Tag>::calc(types...) );
 }
+
+
+//	Any heap allocation by Eigen while it lives fails an assertion , see EIGEN_RUNTIME_NO_MALLOC .
+struct _No_Malloc_Scope
+{
+	_No_Malloc_Scope(){  Eigen::internal::set_is_malloc_allowed(false);  }
+	~_No_Malloc_Scope(){  Eigen::internal::set_is_malloc_allowed(true);  }
+};
 //========//========//========//========//=======#//========//========//========//========//=======#
 
 
@@ -47,6 +55,160 @@ static void Least_Square_Solution()
 }
 
 
+static void Least_Square_Solver()
+{
+	Matrix<float, 3, 2> const A
+	{	-1.f, -.0827f
+	,	-.737f, .0655f
+	,	.511f, -.562f
+	};
+
+	Matrix<float, 3, 3> const B
+	{	-.906f, .1f, 0.f
+	,	.358f, -.2f, 1.f
+	,	.359f, .3f, -.5f
+	};
+
+	Matrix<float, 2, 3> const X_answer = (A.transpose()*A).inv()*A.transpose()*B;
+
+	auto const qr_solver = s3d::Least_Square_Problem::solver<s3d::Solving_Mode::QR>(A);
+	auto const svd_solver = s3d::Least_Square_Problem::solver<s3d::Solving_Mode::SVD>(A);
+	auto const cholesky_solver = s3d::Least_Square_Problem::solver<s3d::Solving_Mode::CHOLESKY>(A);
+
+	SGM_H2U_ASSERT(qr_solver.rows() == 3 && qr_solver.cols() == 2);
+
+	for(size_t j = 0;  j < 3;  ++j)
+	{
+		Vector<float, 3> const b = B.col(j);
+		Vector<float, 2> const x_answer = X_answer.col(j);
+
+		::_identical(x_answer, qr_solver.solve(b), svd_solver.solve(b), cholesky_solver.solve(b));
+	}
+
+	Matrix<float, 2, 3> const 
+		X_qr = qr_solver.solve(B), 
+		X_svd = svd_solver.solve(B), 
+		X_cholesky = cholesky_solver.solve(B);
+
+	::_identical(X_answer, X_qr, X_svd, X_cholesky);
+
+	{
+		s3d::DynamicMat<float> const A_dyn = A;
+		s3d::DynamicMat<float> const B_dyn = B;
+
+		auto solver = s3d::Least_Square_Problem::solver<s3d::Solving_Mode::QR>(A_dyn);
+
+		s3d::DynamicMat<float> const X = solver.solve(B_dyn);
+
+		::_identical(X_answer, X);
+
+		solver(2.f*A_dyn);
+
+		::_identical( X_answer, 2.f*Matrix<float, 2, 3>(solver.solve(B_dyn)) );
+	}
+}
+
+
+static void Iterative_Least_Square()
+{
+	using Entry = s3d::SparseMat<double>::Entry;
+
+	//	a banded 8x4 design matrix with badly scaled columns
+	std::vector<Entry> entries;
+
+	for(size_t i = 0;  i < 8;  ++i)
+		entries.push_back( Entry{i, i % 4, 1.0 + .1*double(i)} ),
+		entries.push_back(  Entry{ i, (i + 1) % 4, 100.0*( .5 - .05*double(i) ) }  );
+
+	s3d::SparseMat<double> const A(8, 4, entries);
+
+	Vector<double> const b{1., -2., .5, 3., -1., 2., .25, -.75};
+	
+	Vector<double> const x_answer 
+	=	s3d::Least_Square_Problem::solution<s3d::Solving_Mode::QR>(A.dense(), b);
+
+	//	entries of A span two orders of magnitude , so errors are measured relative to the answer .
+	double constexpr rel_tol = 1e-9;
+
+	auto const close_f
+	=	[](auto const& x, auto const& x_star, double const tol)
+		{
+			return (x - x_star).norm() <= tol*x_star.norm();
+		};
+
+	auto const options = sgm::Flags( s3d::flag::Tolerance<double>(1e-12) );
+
+	auto const lsqr = s3d::Least_Square_Problem::solver<s3d::Solving_Mode::LSQR>(A, options);
+	auto const cg = s3d::Least_Square_Problem::solver<s3d::Solving_Mode::CG>(A, options);
+
+	auto const [x_lsqr, lsqr_stats] = lsqr.solve_with_stats(b);
+	auto const [x_cg, cg_stats] = cg.solve_with_stats(b);
+
+	SGM_H2U_ASSERT( close_f(x_lsqr, x_answer, rel_tol) && close_f(x_cg, x_answer, rel_tol) );
+	SGM_H2U_ASSERT( close_f(lsqr.solve(b), x_lsqr, 0.) );
+
+	SGM_H2U_ASSERT(lsqr_stats.converged && cg_stats.converged);
+	SGM_H2U_ASSERT(lsqr_stats.nof_iterations <= 8 && cg_stats.nof_iterations <= 8);
+
+	SGM_H2U_ASSERT
+	(	lsqr_stats.normal_residual_norm 
+		<=	rel_tol*Vector<double>( A.dense().transpose()*b ).norm()
+	);
+
+	{
+		double const answer_residual_norm = Vector<double>(A.dense()*x_answer - b).norm();
+
+		SGM_H2U_ASSERT
+		(	std::abs(lsqr_stats.residual_norm - answer_residual_norm) 
+			<=	rel_tol*answer_residual_norm
+		);
+	}
+	{
+		auto const preconditioned
+		=	s3d::Least_Square_Problem::solver<s3d::Solving_Mode::LSQR>
+			(	A
+			,	sgm::Flags( s3d::flag::Tolerance<double>(1e-12), s3d::flag::Preconditioned{} )
+			);
+
+		SGM_H2U_ASSERT( close_f(preconditioned.solve(b), x_answer, rel_tol) );
+
+		SGM_H2U_ASSERT
+		(	close_f
+			(	s3d::Least_Square_Problem::solution<s3d::Solving_Mode::CG>
+				(	A, b
+				,	sgm::Flags( s3d::flag::Tolerance<double>(1e-12), s3d::flag::Preconditioned{} )
+				)
+			,	x_answer, rel_tol
+			)
+		);
+	}
+	{
+		auto const capped
+		=	s3d::Least_Square_Problem::solver<s3d::Solving_Mode::CG>
+			(	A, sgm::Flags( s3d::flag::Tolerance<double>(1e-12), s3d::flag::Iteration_Cap(1) )
+			);
+
+		auto const stats = capped.solve_with_stats(b).second;
+
+		SGM_H2U_ASSERT(stats.nof_iterations == 1 && !stats.converged);
+	}
+	{
+		s3d::DynamicMat<double> B(8, 2);
+
+		for(size_t i = 0;  i < 8;  ++i)
+			B(i, 0) = b(i),  B(i, 1) = -2.*b(i);
+
+		auto const [X, stats] = lsqr.solve_with_stats(B);
+
+		SGM_H2U_ASSERT
+		(	close_f( Vector<double>(X.col(0)), x_answer, rel_tol )
+		&&	close_f( Vector<double>(X.col(1)), Vector<double>(-2.*x_answer), rel_tol )
+		&&	stats.converged
+		);
+	}
+}
+
+
 static void Eigen_Decomp()
 {
 	Matrix<float, 2, 2> const Mat1
@@ -106,6 +268,75 @@ static void Eigen_Decomp()
 }
 
 
+static void Symmetric_Eigen_Batch()
+{
+	s3d::PointSet<float, 6> const covs
+	{	Vector<float, 6>{2.f, 0.f, 0.f, 3.f, 0.f, 1.f}
+	,	Vector<float, 6>{2.f, -1.f, 0.f, 2.f, -1.f, 2.f}
+	,	Vector<float, 6>{.5f, .1f, -.2f, .3f, .05f, .02f}
+	,	Vector<float, 6>{1.f, 0.f, 0.f, 1.f, 0.f, 1.f}
+	};
+
+	auto mat_f
+	=	[&covs](size_t const idx)
+		{
+			auto const c = covs.point(idx);
+
+			return
+			Matrix<float, 3, 3>
+			{	c(0), c(1), c(2)
+			,	c(1), c(3), c(4)
+			,	c(2), c(4), c(5)
+			};
+		};
+
+	s3d::Symmetric_Eigen_Batch<float, 3> const seq_batch(covs), par_batch(s3d::PAR, covs);
+
+	SGM_H2U_ASSERT(seq_batch.size() == covs.size() && par_batch.size() == covs.size());
+
+	for(size_t idx = 0;  idx < covs.size();  ++idx)
+	{
+		Matrix<float, 3, 3> const M = mat_f(idx);
+		
+		s3d::Eigen_Decomposition ed(M, sgm::Flag_Set<s3d::flag::Real_Symmetric>{});
+
+		SGM_H2U_ASSERT
+		(	seq_batch.eigenval(idx, 0) <= seq_batch.eigenval(idx, 1) 
+		&&	seq_batch.eigenval(idx, 1) <= seq_batch.eigenval(idx, 2) 
+		);
+
+		for(size_t k = 0;  k < 3;  ++k)
+		{
+			float const val = seq_batch.eigenval(idx, k);
+			Vector<float, 3> const vec = seq_batch.eigenvec(idx, k);
+
+			::_identical( val, par_batch.eigenval(idx, k), ed.eigenval(k) );
+			::_identical( vec, par_batch.eigenvec(idx, k) );
+			::_identical( vec.norm(), 1.f );
+			::_identical( M*vec, val*vec );
+		}
+	}
+
+	{
+		s3d::Symmetric_Eigen_Batch<float, 3> const value_only
+		(	covs, sgm::Flag_Set<s3d::flag::Value_Only>{}
+		);
+
+		SGM_H2U_ASSERT(value_only.eigenvecs(0).empty());
+
+		::_identical(value_only.eigenvals().lane(1), seq_batch.eigenvals().lane(1));
+	}
+	{
+		s3d::Symmetric_Eigen_Batch<float, 2> const batch2
+		(	s3d::PointSet<float, 3>{ Vector<float, 3>{5.f, -2.f, 2.f} }
+		);
+
+		::_identical( batch2.eigenval(0, 0), 1.f );
+		::_identical( batch2.eigenval(0, 1), 6.f );
+	}
+}
+
+
 static void Singular_Value_Decomp()
 {
 	s3d::DynamicMat<float> const A
@@ -234,8 +465,250 @@ static void Singular_Value_Decomp()
 }
 
 
+static void Fixed_Size_SVD()
+{
+	Matrix<float, 3, 3> const A
+	{	.3f, -.7f, .2f
+	,	.5f, .1f, -.4f
+	,	-.2f, .6f, .9f
+	};
+
+	s3d::Singular_Value_Decomposition svd(A);
+	
+	Matrix<float> const U = svd.Umat(), V = svd.Vmat(), D = svd.diagmat();
+
+	::_identical(U.rows(), U.cols(), V.rows(), V.cols(), D.rows(), D.cols(), size_t(3));
+	::_identical(A, U*D*V.transpose());
+	::_identical( U.transpose()*U, Matrix<float, 3, 3>::identity() );
+
+	{
+		s3d::PointSet<float, 9> const mats
+		{	Vector<float, 9>{.3f, -.7f, .2f, .5f, .1f, -.4f, -.2f, .6f, .9f}
+		,	Vector<float, 9>{1.f, 0.f, 0.f, 0.f, 0.f, -2.f, 0.f, .5f, 0.f}
+		,	Vector<float, 9>{.1f, .2f, .3f, .2f, .4f, .6f, .3f, .6f, .9f}
+		};
+
+		s3d::Singular_Value_Batch<float, 3> const seq_batch(mats), par_batch(s3d::PAR, mats);
+
+		for(size_t idx = 0;  idx < mats.size();  ++idx)
+		{
+			auto const p = mats.point(idx);
+
+			Matrix<float, 3, 3> const 
+				M
+				{	p(0), p(1), p(2)
+				,	p(3), p(4), p(5)
+				,	p(6), p(7), p(8)
+				},
+				D 
+				{	seq_batch.singularval(idx, 0), 0.f, 0.f
+				,	0.f, seq_batch.singularval(idx, 1), 0.f
+				,	0.f, 0.f, seq_batch.singularval(idx, 2)
+				};
+
+			s3d::Singular_Value_Decomposition const svd_each(M);
+
+			for(size_t k = 0;  k < 3;  ++k)
+				::_identical
+				(	seq_batch.singularval(idx, k), par_batch.singularval(idx, k)
+				,	svd_each.singularval(k)
+				);
+
+			::_identical(M, seq_batch.Umat(idx)*D*seq_batch.Vmat(idx).transpose());
+			::_identical(seq_batch.Umat(idx), par_batch.Umat(idx));
+		}
+
+		s3d::Singular_Value_Batch<float, 3> const u_only
+		(	mats, sgm::Flag_Set<s3d::flag::UMat_Only>{}
+		);
+
+		SGM_H2U_ASSERT(u_only.Ucols(0).size() == mats.size() && u_only.Vcols(0).empty());
+	}
+	{
+		Matrix<float, 3, 2> const B
+		{	-1.f, -.0827f
+		,	-.737f, .0655f
+		,	.511f, -.562f
+		};
+
+		Vector<float, 3> const b{-.906f, .358f, .359f};
+
+		Vector<float, 2> const
+			x_answer = (B.transpose()*B).inv()*B.transpose()*b,
+			x_svd = s3d::Least_Square_Problem::template solution<s3d::Solving_Mode::SVD>(B, b);
+
+		::_identical(x_answer, x_svd);
+	}
+	{
+		//	tall enough that full U would not fit on the stack .
+		Matrix<double, 200, 6> C;
+		Vector<double, 200> c;
+
+		for(size_t i = 0;  i < 200;  ++i)
+		{
+			for(size_t j = 0;  j < 6;  ++j)
+				C(i, j) = std::cos( double(7*i + 3*j + i*j) );
+
+			c(i) = std::sin( double(i) );
+		}
+
+		Vector<double, 6> const
+			x_qr = s3d::Least_Square_Problem::template solution<s3d::Solving_Mode::QR>(C, c),
+			x_svd = s3d::Least_Square_Problem::template solution<s3d::Solving_Mode::SVD>(C, c);
+
+		::_identical(x_qr, x_svd);
+	}
+}
+
+
+static void Workspace_Reuse()
+{
+	s3d::DynamicMat<float> A = Matrix<float>(4, 3);
+	
+	A	=	{	.3f, -.7f, .2f
+			,	.5f, .1f, -.4f
+			,	-.2f, .6f, .9f
+			,	.1f, .0f, -.3f
+			};
+
+	s3d::Singular_Value_Decomposition svd(A);
+
+	for(int i = 0;  i < 10;  ++i)
+	{
+		A(0, 0) = .1f*static_cast<float>(i);
+
+		{
+			::_No_Malloc_Scope const no_malloc;
+
+			svd(A);
+		}
+
+		::_identical(A, svd.Umat()*svd.diagmat()*svd.Vmat().transpose());
+	}
+
+	{
+		Matrix<float, 3, 3> const B = A.block(0, 0, 3, 3);
+
+		s3d::Singular_Value_Decomposition fixed_svd(B);
+
+		::_No_Malloc_Scope const no_malloc;
+
+		fixed_svd(B),  fixed_svd(B);
+	}
+	{
+		//	rank 2 , so that truncation keeps the reconstruction .
+		s3d::DynamicMat<float> C = Matrix<float>(4, 3);
+
+		C	=	{	.3f, -.7f, .2f
+				,	.5f, .1f, -.4f
+				,	.8f, -.6f, -.2f
+				,	-.2f, -.8f, .6f
+				};
+
+		auto const truncated = sgm::Flags( s3d::flag::RelativelyTrunc<float>(.03f) );
+
+		s3d::Singular_Value_Decomposition trunc_svd(C, truncated);
+
+		for(int i = 0;  i < 10;  ++i)
+		{
+			{
+				::_No_Malloc_Scope const no_malloc;
+
+				trunc_svd(C, truncated);
+			}
+
+			SGM_H2U_ASSERT
+			(	trunc_svd.nof_singularvals() == 2
+			&&	trunc_svd.Umat().cols() == 2 && trunc_svd.Vmat().cols() == 2
+			);
+
+			::_identical(C, trunc_svd.Umat()*trunc_svd.diagmat()*trunc_svd.Vmat().transpose());
+		}
+	}
+}
+
+
+static void SVD_Accessors()
+{
+	s3d::DynamicMat<float> const A 
+	=	Matrix<float>(4, 3)
+	=	{	.3f, -.7f, .2f
+		,	.5f, .1f, -.4f
+		,	-.2f, .6f, .9f
+		,	.1f, .0f, -.3f
+		};
+
+	s3d::Singular_Value_Decomposition const svd(A);
+
+	{
+		::_No_Malloc_Scope const no_malloc;
+
+		auto const U = svd.Umat();
+		auto const S = svd.diagmat();
+		auto const V = svd.Vmat();
+
+		SGM_H2U_ASSERT
+		(	U.rows() == 4 && U.cols() == 3 && S.rows() == 3 && S.cols() == 3
+		&&	V.rows() == 3 && V.cols() == 3
+		);
+	}
+
+	::_identical(A, svd.Umat()*svd.diagmat()*svd.Vmat().transpose());
+
+	auto const U = s3d::Singular_Value_Decomposition(A).Umat();
+	auto const S = s3d::Singular_Value_Decomposition(A).diagmat();
+	auto const V = s3d::Singular_Value_Decomposition(A).Vmat();
+
+	static_assert
+	(	std::is_same_v< decltype(U), s3d::DynamicMat<float> const >
+	&&	std::is_same_v< decltype(S), s3d::DynamicMat<float> const >
+	&&	std::is_same_v< decltype(V), s3d::DynamicMat<float> const >
+	);
+
+	::_identical(A, U*S*V.transpose());
+}
+
+
+static void On_Matrix_View()
+{
+	//	4x3 design matrix in every other column of a 4x6 ROW_FIRST buffer , as a sensor would give .
+	float buffer[4*6] = {};
+
+	for(std::size_t i = 0;  i < 4*6;  ++i)
+		buffer[i] = float(i*i % 7) + .25f*i;
+
+	s3d::MatrixView<float const, s3d::DYNAMIC, s3d::DYNAMIC, s3d::Storing_Order::ROW_FIRST> const
+		A(buffer, 4, 3, 6, 2);
+
+	s3d::MatrixView<float const, 4, 1> const b(buffer + 1, 4, 1, 4, 6);
+
+	Matrix<float> const A_copy = A;
+	Vector<float, 4> const b_copy = b;
+
+	::_identical
+	(	s3d::Least_Square_Problem::solution(A, b)
+	,	s3d::Least_Square_Problem::solution(A_copy, b_copy)
+	);
+
+	s3d::Singular_Value_Decomposition const svd1(A);
+	s3d::Singular_Value_Decomposition const svd2(A_copy);
+
+	for(std::size_t k = 0;  k < svd1.nof_singularvals();  ++k)
+		::_identical( svd1.singularval(k), svd2.singularval(k) );
+
+	::_identical( svd1.Umat(), svd2.Umat() ),  ::_identical( svd1.Vmat(), svd2.Vmat() );
+}
+
+
 SGM_HOW2USE_TESTS(s3d::spec::Test_, Decomposition, /**/)
 {	::Least_Square_Solution
+,	::Least_Square_Solver
+,	::Iterative_Least_Square
 ,	::Eigen_Decomp
+,	::Symmetric_Eigen_Batch
 ,	::Singular_Value_Decomp
+,	::Fixed_Size_SVD
+,	::Workspace_Reuse
+,	::SVD_Accessors
+,	::On_Matrix_View
 };
@@ -0,0 +1,240 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../Affine/Test_Affine.hpp"
+#include "Test_DualQuaternion.hpp"
+#include <array>
+#include <vector>
+
+
+using s3d::Vector;
+using s3d::UnitVec;
+using s3d::UnitDualQuaternion;
+using s3d::spec::Pi;
+
+
+template<class...TYPES>
+static void _identical(TYPES...types)
+{
+	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_Affine_Tag>::calc(types...) );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Construction()
+{
+	Vector<float, 3> const v{1, -2, 3};
+
+	{
+		UnitDualQuaternion<float> const udq;
+
+		::_identical( udq.translation(), Vector<float, 3>::Zero() );
+		::_identical( udq(v), v );
+	}
+	{
+		s3d::UnitQuaternion<float> const q = s3d::Rotation<float, 3>(Pi/5.f, -Pi/7.f, Pi/8.f).cunit_qtn();
+		Vector<float, 3> const t{.5f, 2.f, -1.f};
+
+		UnitDualQuaternion const udq(q, t);
+
+		::_identical( udq.translation(), t );
+		::_identical( udq.rotation().qtn().w(), q.w() );
+		::_identical( udq.rotation().v(), q.v() );
+		::_identical( udq.dqtn().norm(), 1.f );
+	}
+	{
+		auto const rbtr
+		=	s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, 2, 3}, Pi/3.f).translate(1, -1, 2);
+
+		UnitDualQuaternion const udq = rbtr;
+		s3d::Rigid_Body_Transform<float, 3> const rbtr2 = udq;
+
+		::_identical(rbtr2, rbtr);
+		::_identical( udq(v), v >> rbtr );
+	}
+}
+
+
+static void Composition()
+{
+	Vector<float, 3> const v{1, -2, 3};
+
+	auto const
+		rbtr1 = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, 1, 1}, Pi*2.f/3.f).translate(0, 2, 0),
+		rbtr2 = s3d::Afn<float, 3>.translate(2, 0, 0).rotate(UnitVec<float, 3>{0, 0, 1}, Pi/2.f);
+
+	UnitDualQuaternion const udq1 = rbtr1,  udq2 = rbtr2;
+
+	//	udq2*udq1 applies udq1 first .
+	::_identical( (udq2*udq1)(v), v >> rbtr1 >> rbtr2, udq2(udq1(v)) );
+	::_identical( (udq2*udq1).rigid_body_transform(), rbtr1 >> rbtr2 );
+
+	::_identical( udq1.inv()(udq1(v)), v );
+	::_identical( (udq1*udq1.inv()).translation(), Vector<float, 3>::Zero() );
+
+	auto udq = udq1;
+
+	udq *= udq2;
+
+	::_identical( udq(v), udq1(udq2(v)) );
+}
+
+
+static void Screw_Interpolation()
+{
+	Vector<float, 3> const v{1, 0, 0};
+
+	{
+		UnitDualQuaternion<float> const
+			udq0,
+			udq1( s3d::Rotation<float, 3>(UnitVec<float, 3>{0, 0, 1}, Pi/2.f).cunit_qtn(), Vector<float, 3>{0, 0, 2} );
+
+		::_identical( UnitDualQuaternion<float>::ScLERP(udq0, udq1, 0)(v), udq0(v) );
+		::_identical( UnitDualQuaternion<float>::ScLERP(udq0, udq1, 1)(v), udq1(v) );
+
+		//	half a screw motion along z axis : a quarter turn is halved and so is the advance .
+		::_identical
+		(	UnitDualQuaternion<float>::ScLERP(udq0, udq1, .5f)(v)
+		,	Vector<float, 3>{std::cos(Pi/4.f), std::sin(Pi/4.f), 1.f}
+		);
+	}
+	{
+		UnitDualQuaternion<float> const
+			udq0( s3d::UnitQuaternion<float>(), Vector<float, 3>{1, 2, 3} ),
+			udq1( s3d::UnitQuaternion<float>(), Vector<float, 3>{3, 2, 1} );
+
+		::_identical
+		(	UnitDualQuaternion<float>::ScLERP(udq0, udq1, .25f).translation()
+		,	Vector<float, 3>{1.5f, 2.f, 2.5f}
+		);
+	}
+	{
+		auto const
+			rbtr0 = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, 2, 3}, Pi/3.f).translate(1, -1, 2),
+			rbtr1 = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{-1, 0, 1}, Pi/4.f).translate(0, 3, 1);
+
+		UnitDualQuaternion const udq0 = rbtr0,  udq1 = rbtr1;
+
+		auto const
+			half = UnitDualQuaternion<float>::ScLERP(udq0, udq1, .5f),
+			quarter = UnitDualQuaternion<float>::ScLERP(udq0, udq1, .25f);
+
+		//	interpolation with constant speed along the screw .
+		::_identical( UnitDualQuaternion<float>::ScLERP(udq0, half, .5f)(v), quarter(v) );
+		::_identical( UnitDualQuaternion<float>::ScLERP(udq0, -udq1, 1)(v), udq1(v) );
+	}
+}
+
+
+static void Linear_Blending()
+{
+	Vector<float, 3> const v{1, -2, 3};
+
+	UnitDualQuaternion<float> const
+		udq0( s3d::UnitQuaternion<float>(), Vector<float, 3>{2, 0, 0} ),
+		udq1( s3d::UnitQuaternion<float>(), Vector<float, 3>{0, 4, 0} ),
+		udq2 = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, 2, 3}, Pi/3.f).translate(1, -1, 2);
+
+	{
+		std::vector const udqs{udq0, udq1};
+		std::vector const weights{.75f, .25f};
+
+		::_identical
+		(	UnitDualQuaternion<float>::DLB(udqs, weights).translation(), Vector<float, 3>{1.5f, 1.f, 0.f}
+		);
+	}
+	{
+		std::vector const udqs{udq2, -udq2};
+		std::vector const weights{.5f, .5f};
+
+		::_identical( UnitDualQuaternion<float>::DLB(udqs, weights)(v), udq2(v) );
+	}
+}
+
+
+static void Batch_Kernels()
+{
+	size_t constexpr N = 1000;
+
+	std::vector< UnitDualQuaternion<float> > udqs;
+	std::vector< Vector<float, 3> > points;
+
+	for(size_t idx = 0;  idx < N;  ++idx)
+	{
+		float const s = idx/float(N);
+
+		udqs.push_back
+		(	s3d::Afn<float, 3>
+			.	rotate(UnitVec<float, 3>{1.f, s, 1.f - s}, Pi*s)
+			.	translate(s, 1.f, -s)
+		);
+
+		points.push_back( Vector<float, 3>{s, 1.f - s, 2.f*s} );
+	}
+
+	s3d::PointSet<float, 8> lanes;
+
+	for(auto const& udq : udqs)
+		lanes.push_back( udq.lanes() );
+
+	s3d::Parallel_Policy const policy{4, 16};
+
+	{
+		auto const composed = s3d::compose_all(policy, lanes, lanes);
+
+		for(size_t idx = 0;  idx < N;  idx += 37)
+			::_identical
+			(	UnitDualQuaternion<float>( composed(idx) )(points[idx])
+			,	(udqs[idx]*udqs[idx])(points[idx])
+			);
+	}
+	{
+		std::vector< std::array<size_t, 2> > indices;
+		s3d::PointSet<float, 2> weights;
+
+		for(size_t idx = 0;  idx < N;  ++idx)
+		{
+			float const s = idx/float(N);
+
+			indices.push_back({idx, N - 1 - idx});
+			weights.push_back( Vector<float, 2>{s, 1.f - s} );
+		}
+
+		auto const blended = s3d::blend_all(s3d::SEQ, lanes, indices, weights);
+		auto const blended_par = s3d::blend_all(policy, lanes, indices, weights);
+
+		for(size_t idx = 0;  idx < N;  idx += 37)
+		{
+			float const s = idx/float(N);
+
+			std::vector const pair{udqs[idx], udqs[N - 1 - idx]};
+			std::vector const ws{s, 1.f - s};
+
+			auto const udq = UnitDualQuaternion<float>::DLB(pair, ws);
+
+			::_identical( UnitDualQuaternion<float>( blended(idx) )(points[idx]), udq(points[idx]) );
+			::_identical( blended(idx), blended_par(idx) );
+		}
+	}
+	{
+		s3d::PointSet<float, 3> ps = points;
+
+		s3d::transform_all(policy, ps, lanes);
+
+		for(size_t idx = 0;  idx < N;  ++idx)
+			::_identical( ps(idx), udqs[idx](points[idx]) );
+	}
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, DualQuaternion, /**/)
+{	::Construction
+,	::Composition
+,	::Screw_Interpolation
+,	::Linear_Blending
+,	::Batch_Kernels
+};
@@ -0,0 +1,18 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#include "../Test_s3d.hpp"
+#include "SGM/How2use.hpp"
+#include "S3D/DualQuaternion/DualQuaternion.hpp"
+
+
+namespace s3d::spec
+{
+
+	SGM_HOW2USE_CLASS(Test_, DualQuaternion, /**/);
+
+}
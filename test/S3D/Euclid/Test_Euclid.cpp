@@ -128,9 +128,160 @@ static void Position()
 		::_identical(pos, Position(P1), Position(L1), Vector<float>{1, 2, 3});
 	}
 }
+
+
+static void Batch_Kernels()
+{
+	s3d::PointSet<float, 3> points;
+
+	//	full blocks of points and a partial one .
+	for(size_t i = 0;  i < 1000;  ++i)
+		points.push_back
+		(	Vector<float, 3>{std::sin(.1f*i), 2*std::cos(.37f*i), std::sin(.01f*i*i) - 1.f}
+		);
+
+	s3d::Plane const P(Vector<float, 3>{.5f, -1.f, 1.5f}, UnitVec<float, 3>{1, -2, 2});
+	s3d::Line const L(Vector<float, 3>{-1.f, .5f, .2f}, UnitVec<float, 3>{2, 1, -1});
+
+	auto batch_f
+	=	[&](auto const& policy)
+		{
+			std::vector<float> dists, sqr_dists_P, sqr_dists_L;
+			s3d::PointSet<float, 3> on_P, on_L = points;
+
+			s3d::signed_dist_all(policy, points, P, dists);
+			s3d::sqrDistance_all(policy, points, P, sqr_dists_P);
+			s3d::sqrDistance_all(policy, points, L, sqr_dists_L);
+			s3d::Projection_all(policy, points, P, on_P);
+			s3d::Projection_all(policy, on_L, L, on_L);  // in place
+
+			SGM_H2U_ASSERT
+			(	dists.size() == points.size() && sqr_dists_L.size() == points.size()
+			&&	on_P.size() == points.size() && on_L.size() == points.size()
+			);
+
+			for(size_t i = 0;  i < points.size();  ++i)
+			{
+				Vector<float, 3> const p = points(i);
+
+				::_identical( dists[i], P.signed_dist_to(p) );
+				::_identical( sqr_dists_P[i], static_cast<float>(s3d::sqrDistance(p, P)) );
+				::_identical( sqr_dists_L[i], static_cast<float>(s3d::sqrDistance(p, L)) );
+				::_identical( on_P(i), Vector<float, 3>(s3d::Projection(p, P)) );
+				::_identical( on_L(i), Vector<float, 3>(s3d::Projection(p, L)) );
+			}
+		};
+
+	batch_f(s3d::SEQ);
+	batch_f( s3d::Parallel_Policy{3, 100} );
+}
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+static void Line_Line()
+{
+	s3d::Line const 
+		L1(Vector<float, 3>{0, 0, 0}, UnitVec<float, 3>{1, 0, 0}),
+		L2(Vector<float, 3>{2, 5, 3}, UnitVec<float, 3>{0, 1, 0}),
+		L3(Vector<float, 3>{1, 2, 2}, UnitVec<float, 3>{-1, 0, 0});
+
+	::_identical( Distance(L1, L2), 3.f );
+	::_identical( Projection(L1, L2).v(), Vector<float, 3>{2, 0, 3} );
+	::_identical( Projection(L2, L1).v(), Vector<float, 3>{2, 0, 0} );
+
+	//	parallel lines have no unique closest points but still a distance .
+	SGM_H2U_ASSERT( !Projection(L1, L3).has_value() );
+	::_identical( sqrDistance(L1, L3), 8.f );
+
+	{
+		//	nearly parallel lines crossing at P , given by points far from it .
+		Vector<float, 3> const P{1.f, -2.f, .5f};
+		UnitVec<float, 3> const t1{1.f, 0.f, 0.f},  t2{1.f, 1e-4f, 0.f};
+
+		s3d::Line const L4(P + 10.f*t1, t1),  L5(P - 10.f*t2, t2);
+
+		SGM_H2U_ASSERT( Distance(L4, L5) < 1e-5f && Distance(L5, L4) < 1e-5f );
+
+		//	the crossing moves by about epsilon * 10 / sine along the lines at most .
+		SGM_H2U_ASSERT( Vector<float, 3>(Projection(L4, L5).v() - P).norm() < 1e-2f );
+	}
+
+	{
+		//	parallel lines whose tangents differ by rounding errors only .
+		Vector<float, 3> const d{1.f, 2.f, 3.f},  w{0.f, 3.f, -2.f};
+
+		s3d::Line const 
+			L6(Vector<float, 3>{1, 2, 3}, UnitVec<float, 3>(d)),
+			L7(Vector<float, 3>{1, 2, 3} + 2.f*w, UnitVec<float, 3>(3.7f*d));
+
+		SGM_H2U_ASSERT
+		(	std::abs( Distance(L6, L7) - 2.f*w.norm() ) < 1e-4f
+		&&	std::abs( Distance(L7, L6) - 2.f*w.norm() ) < 1e-4f
+		);
+	}
+}
+
+
+static void Segments()
+{
+	s3d::Segment const 
+		S1(Vector<float, 3>{0, 0, 0}, Vector<float, 3>{2, 0, 0}),
+		S2(Vector<float, 3>{3, 1, 0}, Vector<float, 3>{3, 1, 4}),
+		S3(Vector<float, 3>{1, 2, 0}, Vector<float, 3>{1, -2, 0}),
+		S4(Vector<float, 3>{4, 1, 0}, Vector<float, 3>{6, 1, 0}),
+		Pt(Vector<float, 3>{1, 1, 1}, Vector<float, 3>{1, 1, 1});
+
+	//	closest points at an end of both , crossing , collinear with a gap , and a degenerate one .
+	::_identical( sqrDistance(S1, S2), 2.f );
+	::_identical( Distance(S1, S3), 0.f );
+	::_identical( Distance(S1, S4), std::sqrt(5.f) );
+	::_identical( sqrDistance(Pt, S1), 2.f );
+
+	::_identical( Projection(Vector<float, 3>{-1, 1, 0}, S1), Vector<float, 3>{0, 0, 0} );
+	::_identical( Projection(Vector<float, 3>{1.5f, 1.f, 0.f}, S1), Vector<float, 3>{1.5f, 0.f, 0.f} );
+	::_identical( Distance(Vector<float, 3>{3, 0, 4}, S1), std::sqrt(17.f) );
+}
+
+
+static void Ray_Casting()
+{
+	s3d::Ray const R(Vector<float, 3>{.25f, .25f, 1.f}, UnitVec<float, 3>{0, 0, -1});
+
+	s3d::Triangle const 
+		T1(Vector<float, 3>{0, 0, 0}, Vector<float, 3>{1, 0, 0}, Vector<float, 3>{0, 1, 0}),
+		T2(Vector<float, 3>{0, 0, 2}, Vector<float, 3>{1, 0, 2}, Vector<float, 3>{0, 1, 2}),
+		T3(Vector<float, 3>{1, 1, 0}, Vector<float, 3>{2, 1, 0}, Vector<float, 3>{1, 2, 0}),
+		T4(Vector<float, 3>{0, 0, 0}, Vector<float, 3>{0, 1, 0}, Vector<float, 3>{0, 0, 1});
+
+	//	a hit , one behind the ray , one off to the side and one edge-on .
+	::_identical( intersection(R, T1).v(), Vector<float, 3>{.25f, .25f, 0.f} );
+	SGM_H2U_ASSERT
+	(	!intersection(R, T2).has_value() && !intersection(R, T3).has_value()
+	&&	!intersection(R, T4).has_value()
+	);
+
+	s3d::Plane const 
+		P1(Vector<float, 3>{0, 0, -3}, UnitVec<float, 3>{0, 0, 1}),
+		P2(Vector<float, 3>{0, 0, 5}, UnitVec<float, 3>{0, 1, 1});
+
+	::_identical( intersection(R, P1).v(), Vector<float, 3>{.25f, .25f, -3.f} );
+	SGM_H2U_ASSERT( !intersection(R, P2).has_value() );
+
+	std::vector< s3d::Triangle<float, 3> > const triangles{T1, T2, T3, T4};
+	std::vector<float> distances;
+
+	s3d::ray_cast_all(s3d::PAR, R, triangles, distances);
+
+	float constexpr inf = std::numeric_limits<float>::infinity();
+
+	SGM_H2U_ASSERT
+	(	distances.size() == 4 && distances[1] == inf && distances[2] == inf && distances[3] == inf
+	);
+
+	::_identical( distances[0], 1.f );
+}
+
+
 SGM_HOW2USE_TESTS(s3d::spec::Test_, Euclid, /**/)
 {	::Construction
 ,	::Projection
@@ -138,4 +289,8 @@ SGM_HOW2USE_TESTS(s3d::spec::Test_, Euclid, /**/)
 ,	::intersection
 ,	::Direction
 ,	::Position
+,	::Batch_Kernels
+,	::Line_Line
+,	::Segments
+,	::Ray_Casting
 };
@@ -880,6 +880,265 @@ static void _as_Vector_iterable()
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
+template<std::size_t N, s3d::Storing_Order STOR>
+static void _Fixed_Size_Kernel_of()
+{
+	using Kernel = s3d::_Fixed_Kernel_Helper<float>;
+	using Mat_t = s3d::Matrix<float, N, N, STOR>;
+	using Dyn_t = s3d::DynamicMat<float>;
+
+	Mat_t A, B;
+	s3d::Vector<float, N> u, v;
+	s3d::RowVec<float, N> w;
+
+	//	diagonally dominant for a well conditioned inverse .
+	for(std::size_t i = 0;  i < N;  ++i)
+	{
+		for(std::size_t j = 0;  j < N;  ++j)
+			A(i, j) = float( (7*i + 3*j) % 5 )/4 + (i == j ? 3.f : 0.f),
+			B(i, j) = float( (2*i + 5*j + 1) % 7 )/4 - 1;
+
+		u(i) = float(i) - 1.5f,  v(i) = .5f*i + .25f,  w(i) = 1 - float(i);
+	}
+
+	//	Matrices of dynamic size are always done by Eigen .
+	Dyn_t const DA = A,  DB = B;
+	s3d::Vector<float> const du = u,  dv = v;
+	s3d::RowVec<float> const dw = w;
+
+	::_identical( Kernel::add(A, B), Dyn_t(DA + DB) );
+	::_identical( Kernel::sub(A, B), Dyn_t(DA - DB) );
+	::_identical( Kernel::neg(A), Dyn_t(-DA) );
+	::_identical( Kernel::mul(A, 2.5f), Dyn_t(DA*2.5f) );
+	::_identical( Kernel::mul(A, B), Dyn_t(DA*DB) );
+	::_identical( Kernel::mul(A, u), s3d::Vector<float>(DA*du) );
+	::_identical( Kernel::mul(w, A), s3d::RowVec<float>(dw*DA) );
+	::_identical( Kernel::mul(u, w), Dyn_t(du*dw) );
+	::_identical( Kernel::transpose(B), Dyn_t( DB.transpose() ) );
+	::_identical( Kernel::inv(A), Dyn_t( DA.inv() ) );
+	::_identical( Kernel::det(A), DA.det() );
+	::_identical( Kernel::dot(u, v), du.dot(dv) );
+	::_identical( Kernel::dyadic(u, v), Dyn_t( du.dyadic(dv) ) );
+
+	if constexpr(N == 3)
+	{
+		::_identical
+		(	Kernel::cross(u, v)
+		,	s3d::Vector<float, 3>{u(1)*v(2) - u(2)*v(1), u(2)*v(0) - u(0)*v(2), u(0)*v(1) - u(1)*v(0)}
+		);
+		::_identical( Kernel::skew(u)*v, Kernel::cross(u, v) );
+	}
+}
+
+
+static void _Fixed_Size_Kernels()
+{
+	//	kernels are evaluated at compile time as well .
+	static_assert
+	(	[]() constexpr
+		{
+			double const a[9] = {2, 0, 0,  0, 4, 0,  1, 0, 8};
+			double b[9] = {};
+
+			s3d::_Fixed_Kernel<double>::inv<3>(a, b);
+
+			return s3d::_Fixed_Kernel<double>::det<3>(a) == 64 && b[0] == .5 && b[6] == -.0625;
+		}()
+	);
+
+	::_Fixed_Size_Kernel_of<2, s3d::Storing_Order::COL_FIRST>();
+	::_Fixed_Size_Kernel_of<3, s3d::Storing_Order::COL_FIRST>();
+	::_Fixed_Size_Kernel_of<4, s3d::Storing_Order::COL_FIRST>();
+	::_Fixed_Size_Kernel_of<2, s3d::Storing_Order::ROW_FIRST>();
+	::_Fixed_Size_Kernel_of<3, s3d::Storing_Order::ROW_FIRST>();
+	::_Fixed_Size_Kernel_of<4, s3d::Storing_Order::ROW_FIRST>();
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+static void _Matrix_View()
+{
+	using s3d::MatrixView;
+	using s3d::Storing_Order;
+
+	float buffer[4*6] = {};
+
+	for(std::size_t i = 0;  i < 4*6;  ++i)
+		buffer[i] = float(i);
+
+	{
+		MatrixView<float, s3d::DYNAMIC, s3d::DYNAMIC, Storing_Order::ROW_FIRST>
+			view(buffer, 4, 3, 6, 2);
+
+		SGM_H2U_ASSERT
+		(	view.rows() == 4 && view.cols() == 3
+		&&	view.outer_stride() == 6 && view.inner_stride() == 2
+		&&	view(1, 2) == buffer[1*6 + 2*2] && view(3, 0) == buffer[3*6]
+		);
+
+		view(2, 1) = -1;
+
+		SGM_H2U_ASSERT(buffer[2*6 + 2] == -1);
+
+		s3d::Matrix<float> const copied = view;
+
+		::_identical( copied.transpose()*view, copied.transpose()*copied );
+
+		view = s3d::Matrix<float>::Zero(4, 3);
+
+		SGM_H2U_ASSERT(buffer[2*6 + 2] == 0 && buffer[2*6 + 3] == 2*6 + 3);
+	}
+	{
+		MatrixView<float const, 3, 3> const view(buffer + 6);
+		s3d::Matrix<float, 3, 3> const M = view;
+
+		SGM_H2U_ASSERT( view(2, 0) == buffer[6 + 2] && M(0, 2) == buffer[6 + 6] );
+
+		::_identical( M*view, M*M );
+		::_identical( view.det(), M.det() );
+	}
+	{
+		MatrixView<float, 3, 1> column(buffer, 3, 1, 3, 6);
+
+		column = s3d::Vector<float, 3>{1, 2, 3};
+
+		SGM_H2U_ASSERT(buffer[0] == 1 && buffer[6] == 2 && buffer[12] == 3);
+		::_identical( column.dot(column), 14.f );
+	}
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+static void _Literal_Matrix()
+{
+	using s3d::LiteralMat;
+	using s3d::LiteralVec;
+	using _Math = s3d::_Literal_Math<double>;
+
+	static LiteralMat<double, 3, 3> constexpr A
+	=	{	2, 0, 0
+		,	0, 4, 0
+		,	1, 0, 8
+		};
+
+	static LiteralMat<double, 3, 3> constexpr A_inv = A.inv();
+	static LiteralVec<double, 3> constexpr z
+	=	LiteralVec<double, 3>::Axis<0>().cross( LiteralVec<double, 3>::Axis<1>() );
+
+	static_assert(A.det() == 64 && A_inv(0, 0) == .5 && A_inv(2, 0) == -.0625);
+	static_assert( (A*A_inv)(1, 1) == 1 && (A*A_inv)(2, 0) == 0 && (A - A)(2, 0) == 0 );
+	static_assert( z(0) == 0 && z(1) == 0 && z(2) == 1 && z.skew()(1, 0) == 1 );
+	static_assert( LiteralVec<double, 2>{3, 4}.norm() == 5 && _Math::sqrt(0) == 0 );
+	static_assert( (2*A.transpose())(0, 2) == 2 && LiteralMat<double, 3, 3>::identity()(2, 2) == 1 );
+
+	{
+		s3d::Matrix<double, 3, 3> const M1 = A;
+		s3d::Matrix<double, 3, 3, s3d::Storing_Order::ROW_FIRST> const M2 = A;
+		s3d::Matrix<double, 3, 3> const M3 = {2, 0, 0,  0, 4, 0,  1, 0, 8};
+
+		::_identical(M1, M3);
+		::_identical( M1.inv(), s3d::Matrix<double, 3, 3>(A_inv) );
+
+		for(std::size_t i = 0;  i < 3;  ++i)
+			for(std::size_t j = 0;  j < 3;  ++j)
+				SGM_H2U_ASSERT( M2(i, j) == A(i, j) );
+	}
+	{
+		LiteralMat<double, 2, 3> constexpr B = {1, -2, 3,  .5, 0, -1};
+		LiteralMat<double, 3, 2> constexpr C = {0, 1,  2, -3,  4, .25};
+		LiteralVec<double, 3> constexpr u = {1, 2, 2},  v = {-1, .5, 3};
+
+		::_identical
+		(	s3d::Matrix<double, 2, 2>(B*C)
+		,	s3d::Matrix<double, 2, 3>(B) * s3d::Matrix<double, 3, 2>(C)
+		);
+
+		::_identical( s3d::UnitVec<double, 3>(u), s3d::Vector<double, 3>{1, 2, 2}/3 );
+		::_identical( u.dot(v), s3d::Vector<double, 3>(u).dot(s3d::Vector<double, 3>(v)) );
+
+		::_identical
+		(	s3d::Matrix<double, 3, 3>( u.dyadic(v) )
+		,	s3d::Vector<double, 3>(u).dyadic( s3d::Vector<double, 3>(v) )
+		);
+	}
+
+	for(double const t : {0., .3, -1.2, 3.14159, 7.5, -40., 100.})
+		::_identical(_Math::sin(t), std::sin(t)),
+		::_identical(_Math::cos(t), std::cos(t)),
+		::_identical( _Math::sqrt(t*t), std::abs(t) );
+
+	//	arguments far beyond the range of long long are reduced without converting to integers .
+	static_assert( _Math::sin(1e20) <= 1 && _Math::sin(1e20) >= -1 );
+	static_assert( _Math::cos(-1e300) <= 1 && _Math::cos(-1e300) >= -1 );
+
+	for(double const t : {1e10, -2e10})
+		::_identical(_Math::sin(t), std::sin(t)),
+		::_identical(_Math::cos(t), std::cos(t));
+
+	SGM_H2U_ASSERT
+	(	std::isnan( _Math::sin(std::numeric_limits<double>::infinity()) )
+	&&	std::isnan( _Math::cos(std::numeric_limits<double>::quiet_NaN()) )
+	);
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+template<size_t N>
+static void _Fused_Expression()
+{
+	using Mat_t = s3d::Matrix<float, N, N>;
+	using Vec_t = s3d::Vector<float, N>;
+
+	Mat_t const I = Mat_t::identity(3);
+
+	Mat_t const A
+	=	Mat_t(3, 3)
+	=	{	1, 2, -1
+		,	0, 3, 1
+		,	2, -2, 4
+		};
+
+	Vec_t const v = Vec_t{.2f, -.4f, .6f},  u = Vec_t{1, -1, 2};
+	float const w = .5f,  x = v(0),  y = v(1),  z = v(2),  s = w*w - v.sqr_norm();
+
+	::_identical
+	(	Mat_t( (w*w - v.sqr_norm())*I + 2.f*w*v.skew() + 2.f*v.dyadic(v) )
+	,	Mat_t(3, 3)
+		=	{	s + 2*x*x,		2*(x*y - w*z),	2*(x*z + w*y)
+			,	2*(x*y + w*z),	s + 2*y*y,		2*(y*z - w*x)
+			,	2*(x*z - w*y),	2*(y*z + w*x),	s + 2*z*z
+			}
+	);
+
+	::_identical( Vec_t(v.skew()*u), Vec_t{-.2f, .2f, .2f} );
+
+	//	operands read while the result is written
+	{
+		Mat_t const AA = A*A,  AAA = A*AA;
+		Mat_t M = A;
+		Vec_t p = u;
+
+		M = M*A;
+		p = A*p;
+
+		::_identical(M, AA);
+		::_identical( p, Vec_t(A*u) );
+
+		M = A,  M += M*A;
+
+		::_identical( M, Mat_t(A + AA) );
+
+		M = A,  M *= AA;
+
+		::_identical(M, AAA);
+
+		M = A,  M = M*M + M*M.transpose() - 2.f*M;
+
+		::_identical( M, Mat_t(AA + A*A.transpose() - 2.f*A) );
+	}
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
 SGM_HOW2USE_TESTS(s3d::spec::Test_, Hamilton, /**/)
 {	::_Construction_and_Resize
 ,	::_Substitution
@@ -897,4 +1156,9 @@ SGM_HOW2USE_TESTS(s3d::spec::Test_, Hamilton, /**/)
 ,	::_invalid_when_divided_by_0
 ,	::_invalid_Matrix
 ,	::_as_Vector_iterable	
+,	::_Fixed_Size_Kernels
+,	::_Matrix_View
+,	::_Literal_Matrix
+,	::_Fused_Expression<3>
+,	::_Fused_Expression<s3d::DYNAMIC>
 };
\ No newline at end of file
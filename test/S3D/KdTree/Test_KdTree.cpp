@@ -0,0 +1,203 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Test_KdTree.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+using s3d::Vector;
+using s3d::PointSet;
+using s3d::Neighbor;
+
+
+template<class...TYPES>
+static void _identical(TYPES...types)
+{
+	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_Number_Tag>::calc(types...) );
+}
+
+
+template<size_t DIM>
+static auto _random_points(std::mt19937& engine, size_t const n)-> PointSet<float, DIM>
+{
+	std::uniform_real_distribution<float> dist(-10.f, 10.f);
+
+	PointSet<float, DIM> res(n);
+
+	for(size_t i = 0;  i < n;  ++i)
+		for(size_t d = 0;  d < DIM;  ++d)
+			res(i, d) = dist(engine);
+
+	return res;
+}
+
+
+//	Nearest answers of a linear scan over points .
+template<size_t DIM>
+static auto _scan(PointSet<float, DIM> const& points, Vector<float, DIM> const& q)
+->	std::vector< Neighbor<float> >
+{
+	std::vector< Neighbor<float> > res;
+
+	for(size_t i = 0;  i < points.size();  ++i)
+		res.push_back({  i, s3d::sqrDistance(q, points(i))  });
+
+	std::sort
+	(	res.begin(), res.end()
+	,	[](Neighbor<float> const& n1, Neighbor<float> const& n2){  return n1.sqr_dist < n2.sqr_dist;  }
+	);
+
+	return res;
+}
+
+
+template<size_t DIM>
+static void _same_as_scan(size_t const nof_points)
+{
+	std::mt19937 engine(2026 + nof_points);
+
+	auto const points = ::_random_points<DIM>(engine, nof_points);
+	auto const queries = ::_random_points<DIM>(engine, 40);
+
+	s3d::KdTree<float, DIM> const tree(s3d::Parallel_Policy{4, 1}, points);
+
+	SGM_H2U_ASSERT( tree.size() == nof_points );
+
+	size_t constexpr k = 5;
+	size_t const kk = std::min(k, nof_points);
+
+	for(size_t i = 0;  i < queries.size();  ++i)
+	{
+		auto const q = queries(i);
+		auto const answers = ::_scan(points, q);
+
+		SGM_H2U_ASSERT( tree.nearest(q).v().index == answers[0].index );
+
+		auto const knn = tree.nearest(q, k);
+
+		SGM_H2U_ASSERT( knn.size() == kk );
+
+		for(size_t j = 0;  j < kk;  ++j)
+		{
+			SGM_H2U_ASSERT( knn[j].index == answers[j].index );
+
+			::_identical(knn[j].sqr_dist, answers[j].sqr_dist);
+		}
+
+		//	halfway between two answers , off the rounding errors of distances
+		size_t const m = nof_points/3;
+
+		float const radius
+		=	nof_points > 1
+			?	std::sqrt( (answers[m].sqr_dist + answers[m + 1].sqr_dist)/2 )
+			:	1.f;
+		auto const found = tree.within(q, radius);
+
+		SGM_H2U_ASSERT
+		(	found.size()
+		==	size_t
+			(	std::count_if
+				(	answers.begin(), answers.end()
+				,	[radius](Neighbor<float> const& a){  return a.sqr_dist <= radius*radius;  }
+				)
+			)
+		);
+
+		for(size_t j = 0;  j < found.size();  ++j)
+			SGM_H2U_ASSERT( found[j].index == answers[j].index );
+	}
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Empty_and_Small_Trees()
+{
+	{
+		s3d::KdTree<float, 3> const tree( PointSet<float, 3>{} );
+
+		SGM_H2U_ASSERT( tree.empty() );
+		SGM_H2U_ASSERT( !tree.nearest(Vector<float, 3>::Zero()).has_value() );
+		SGM_H2U_ASSERT( tree.nearest(Vector<float, 3>::Zero(), 3).empty() );
+		SGM_H2U_ASSERT( tree.within(Vector<float, 3>::Zero(), 1.f).empty() );
+	}
+
+	::_same_as_scan<3>(1);
+	::_same_as_scan<3>(7);
+}
+
+
+static void Nearest_Points()
+{
+	::_same_as_scan<2>(1000);
+	::_same_as_scan<3>(3000);
+	::_same_as_scan<5>(2000);
+
+	{
+		//	points all at the same place or on a line
+		PointSet<float, 3> coincident, collinear;
+
+		for(size_t i = 0;  i < 300;  ++i)
+			coincident.push_back( Vector<float, 3>{1.f, 2.f, 3.f} ),
+			collinear.push_back( Vector<float, 3>{0.f, float(i), 0.f} );
+
+		s3d::KdTree<float, 3> const tree1(coincident),  tree2(collinear);
+
+		SGM_H2U_ASSERT( tree1.within(Vector<float, 3>{1.f, 2.f, 3.5f}, 1.f).size() == 300 );
+		SGM_H2U_ASSERT( tree2.nearest(Vector<float, 3>{-1.f, 99.2f, 2.f}).v().index == 99 );
+		SGM_H2U_ASSERT( tree2.nearest(Vector<float, 3>{0.f, 10.f, 0.f}, 3)[2].sqr_dist == 1.f );
+	}
+}
+
+
+static void Batch_Queries()
+{
+	std::mt19937 engine(17);
+
+	auto const points = ::_random_points<3>(engine, 5000);
+	auto const queries = ::_random_points<3>(engine, 1000);
+
+	s3d::Parallel_Policy const policy{4, 16};
+
+	s3d::KdTree<float, 3> const tree(policy, points),  seq_tree(points);
+
+	size_t constexpr k = 6;
+
+	auto const knn = s3d::nearest_all(policy, tree, queries, k);
+	auto const seq_knn = s3d::nearest_all(s3d::SEQ, seq_tree, queries, k);
+	auto const found = s3d::within_all(policy, tree, queries, 1.5f);
+
+	SGM_H2U_ASSERT( knn.size() == queries.size()*k && found.size() == queries.size() );
+
+	for(size_t i = 0;  i < queries.size();  ++i)
+	{
+		auto const q = queries(i);
+		auto const single_knn = tree.nearest(q, k);
+		auto const single_found = tree.within(q, 1.5f);
+
+		for(size_t j = 0;  j < k;  ++j)
+			SGM_H2U_ASSERT
+			(	knn[i*k + j].index == single_knn[j].index
+			&&	seq_knn[i*k + j].index == single_knn[j].index
+			);
+
+		SGM_H2U_ASSERT( found[i].size() == single_found.size() );
+
+		for(size_t j = 0;  j < found[i].size();  ++j)
+			SGM_H2U_ASSERT( found[i][j].index == single_found[j].index );
+	}
+
+	SGM_H2U_ASSERT( s3d::nearest_all(policy, tree, queries, 0).empty() );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, KdTree, /**/)
+{	::Empty_and_Small_Trees
+,	::Nearest_Points
+,	::Batch_Queries
+};
@@ -0,0 +1,194 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Test_Parallel.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+
+template<class...TYPES>
+static void _identical(TYPES...types)
+{
+	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_Number_Tag>::calc(types...) );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Every_Index_Once()
+{
+	size_t constexpr N = 100'003;
+
+	std::vector<int> visits(N, 0);
+
+	s3d::Parallel_for
+	(	s3d::Parallel_Policy{4, 1000}, N, sizeof(int)
+	,	[&visits](size_t const bi, size_t const ei)
+		{
+			for(size_t i = bi;  i < ei;  ++i)
+				++visits[i];
+		}
+	);
+
+	bool all_once = true;
+
+	for(auto const v : visits)
+		all_once = all_once && v == 1;
+
+	::_identical(all_once, true);
+}
+
+
+static void Chunk_Alignment()
+{
+	size_t constexpr N = 10'000;
+
+	std::vector<size_t> begins(N, 0);
+	std::atomic<size_t> nof_chunks{0};
+
+	s3d::Parallel_for
+	(	s3d::Parallel_Policy{3, 100}, N, sizeof(float)
+	,	[&](size_t const bi, size_t const)
+		{
+			begins[nof_chunks++] = bi;
+		}
+	);
+
+	bool aligned = nof_chunks > 1;
+
+	for(size_t i = 0;  i < nof_chunks;  ++i)
+		aligned = aligned && begins[i] * sizeof(float) % s3d::CACHE_LINE_SIZE == 0;
+
+	::_identical(aligned, true);
+}
+
+
+static void Chunk_Alignment_on_Address()
+{
+	size_t constexpr N = 10'000;
+
+	//	off a cache line by 3 floats wherever the storage lies
+	std::vector<float> storage(N + s3d::CACHE_LINE_SIZE);
+
+	float const* base = storage.data();
+
+	while(reinterpret_cast<std::uintptr_t>(base) % s3d::CACHE_LINE_SIZE != 3*sizeof(float))
+		++base;
+
+	std::vector<size_t> begins(N, 0),  ends(N, 0);
+	std::atomic<size_t> nof_chunks{0};
+
+	s3d::Parallel_for
+	(	s3d::Parallel_Policy{3, 100}, base, N, sizeof(float)
+	,	[&](size_t const bi, size_t const ei)
+		{
+			size_t const c = nof_chunks++;
+
+			begins[c] = bi,  ends[c] = ei;
+		}
+	);
+
+	bool aligned = nof_chunks > 1;
+	size_t nof_covered = 0;
+
+	for(size_t i = 0;  i < nof_chunks;  ++i)
+	{
+		nof_covered += ends[i] - begins[i];
+
+		aligned
+		=	aligned
+		&&	(	begins[i] == 0
+			||	reinterpret_cast<std::uintptr_t>(base + begins[i]) % s3d::CACHE_LINE_SIZE == 0
+			);
+	}
+
+	::_identical(aligned, true);
+	::_identical(nof_covered, N);
+}
+
+
+static void Thread_Reuse()
+{
+	size_t constexpr nof_threads = 4,  nof_calls = 20;
+
+	std::vector<std::thread::id> ids;
+	std::mutex ids_mutex;
+
+	for(size_t n = 0;  n < nof_calls;  ++n)
+		s3d::Parallel_for
+		(	s3d::Parallel_Policy{nof_threads, 16}, 4096, sizeof(int)
+		,	[&](size_t, size_t)
+			{
+				std::lock_guard<std::mutex> const lock(ids_mutex);
+
+				if( std::find(ids.begin(), ids.end(), std::this_thread::get_id()) == ids.end() )
+					ids.push_back( std::this_thread::get_id() );
+			}
+		);
+
+	SGM_H2U_ASSERT(ids.size() <= nof_threads);
+}
+
+
+static void Nested_Call()
+{
+	size_t constexpr N = 1000;
+
+	std::vector<int> visits(N*N, 0);
+
+	s3d::Parallel_for
+	(	s3d::Parallel_Policy{4, 10}, N, sizeof(int)
+	,	[&visits](size_t const bi, size_t const ei)
+		{
+			for(size_t i = bi;  i < ei;  ++i)
+				s3d::Parallel_for
+				(	s3d::Parallel_Policy{4, 10}, N, sizeof(int)
+				,	[&visits, i](size_t const bj, size_t const ej)
+					{
+						for(size_t j = bj;  j < ej;  ++j)
+							++visits[i*N + j];
+					}
+				);
+		}
+	);
+
+	SGM_H2U_ASSERT( std::count(visits.begin(), visits.end(), 1) == static_cast<long>(N*N) );
+}
+
+
+static void Exception_Propagation()
+{
+	bool caught = false;
+
+	try
+	{
+		s3d::Parallel_for
+		(	s3d::Parallel_Policy{4, 10}, 1000, sizeof(double)
+		,	[](size_t const bi, size_t const ei)
+			{
+				if(bi <= 500 && 500 < ei)
+					throw std::runtime_error("expected");
+			}
+		);
+	}
+	catch(std::runtime_error const&)
+	{
+		caught = true;
+	}
+
+	::_identical(caught, true);
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, Parallel, /**/)
+{	::Every_Index_Once
+,	::Chunk_Alignment
+,	::Chunk_Alignment_on_Address
+,	::Exception_Propagation
+,	::Thread_Reuse
+,	::Nested_Call
+};
@@ -0,0 +1,120 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Test_PointSet.hpp"
+#include "S3D/Euclid/Euclid.hpp"
+#include <vector>
+
+
+using s3d::Vector;
+using s3d::UnitVec;
+
+
+template<class...TYPES>
+static void _identical(TYPES...types)
+{
+	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_PointSet_Tag>::calc(types...) );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Construction()
+{
+	{
+		s3d::PointSet<float, 3> const ps1, ps2(4);
+
+		::_identical( ps1.size(), size_t(0) );
+		::_identical( ps2.size(), size_t(4) );
+		::_identical( ps2(3), Vector<float, 3>::Zero() );
+	}
+	{
+		std::vector< Vector<float, 3> > const points
+		{	Vector<float, 3>{1, 2, 3}
+		,	Vector<float, 3>{4, 5, 6}
+		};
+
+		s3d::PointSet const ps1 = points;
+		s3d::PointSet<float, 3> const ps2{ Vector<float, 3>{1, 2, 3}, Vector<float, 3>{4, 5, 6} };
+
+		static_assert(std::is_same_v< decltype(ps1), s3d::PointSet<float, 3> const >);
+
+		::_identical(ps1, ps2);
+		::_identical( ps1(1), points.at(1) );
+	}
+}
+
+
+static void Element_Access()
+{
+	s3d::PointSet<double, 3> ps;
+
+	ps.push_back(Vector<double, 3>{1, 2, 3}).push_back( UnitVec<double, 3>::Axis<1>() );
+
+	::_identical( ps(0), Vector<double, 3>{1, 2, 3} );
+	::_identical( ps(1), Vector<double, 3>{0, 1, 0} );
+	::_identical( ps(0, 2), 3.0 );
+
+	ps.set(1, Vector<double, 3>{7, 8, 9});
+	ps(0, 0) = -1;
+
+	::_identical( ps.point(0), Vector<double, 3>{-1, 2, 3} );
+	::_identical( ps.point(1), Vector<double, 3>{7, 8, 9} );
+	
+	::_identical( ps.lane_data(1)[0], 2.0 );
+	::_identical( ps.lane_data(1)[1], 8.0 );
+}
+
+
+static void Lane_View()
+{
+	s3d::PointSet<float, 3> ps
+	{	Vector<float, 3>{1, 2, 3}
+	,	Vector<float, 3>{4, 5, 6}
+	,	Vector<float, 3>{7, 8, 9}
+	};
+
+	::_identical( Vector<float>(ps.lane(0)), Vector<float>{1, 4, 7} );
+	::_identical( ps.lane(2).dot(ps.lane(2)), 3.f*3.f + 6.f*6.f + 9.f*9.f );
+
+	ps.lane(1) = Vector<float>{-2, -5, -8};
+	ps.lane(2) *= 2.f;
+
+	::_identical
+	(	ps
+	,	s3d::PointSet<float, 3>
+		{	Vector<float, 3>{1, -2, 6}
+		,	Vector<float, 3>{4, -5, 12}
+		,	Vector<float, 3>{7, -8, 18}
+		}
+	);
+
+	//	no copy is made .
+	::_identical( ps.lane(0).data(), ps.lane_data(0) );
+}
+
+
+static void With_Euclid()
+{
+	s3d::PointSet<float, 3> const ps
+	{	Vector<float, 3>{1, 2, 3}
+	,	Vector<float, 3>{4, 5, -6}
+	};
+
+	s3d::Plane const P1(Vector<float, 3>::Zero(), UnitVec<float, 3>::Axis<2>());
+
+	::_identical( s3d::Distance(ps(0), P1), 3.f );
+	::_identical( s3d::Distance(ps(1), P1), 6.f );
+	::_identical( s3d::Projection(ps(1), P1), Vector<float, 3>{4, 5, 0} );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, PointSet, /**/)
+{	::Construction
+,	::Element_Access
+,	::Lane_View
+,	::With_Euclid
+};
@@ -0,0 +1,55 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#pragma once
+#include "../Test_s3d.hpp"
+#include "SGM/How2use.hpp"
+#include "S3D/PointSet/PointSet.hpp"
+
+
+namespace s3d::spec
+{
+
+	enum class _Equiv_PointSet_Tag;
+
+	SGM_HOW2USE_CLASS(Test_, PointSet, /**/);
+
+}
+
+
+template<>
+struct s3d::spec::_Equivalent<s3d::spec::_Equiv_PointSet_Tag>
+{
+	template<class L, class R, class...TYPES>
+	static bool calc(L Lhs, R rhs, [[maybe_unused]] TYPES...args)
+	{
+		if constexpr( sizeof...(TYPES) > 0 )
+			return calc(Lhs, rhs) && calc(Lhs, args...);
+		else if constexpr
+		(	trait::Has_Matrix_interface<L>::value 
+		&&	trait::Has_Matrix_interface<R>::value
+		)
+		{
+			bool res = Lhs.size() == rhs.size();
+
+			for(size_t idx = Lhs.size();  res && idx-->0;)
+				res = _Equivalent<_Equiv_Number_Tag>::calc( Lhs(idx), rhs(idx) );
+
+			return res;
+		}
+		else if constexpr(trait::is_PointSet<L>::value && trait::is_PointSet<R>::value)
+		{
+			bool res = Lhs.size() == rhs.size();
+
+			for(size_t idx = Lhs.size();  res && idx-->0;)
+				res = calc( Lhs(idx), rhs(idx) );
+
+			return res;
+		}
+		else
+			return _Equivalent<_Equiv_Number_Tag>::calc(Lhs, rhs);
+	}
+};
@@ -6,6 +6,7 @@
 
 #include "Test_Quaternion.hpp"
 #include "S3D/Euclid/Euclid.hpp"
+#include <vector>
 
 
 using s3d::Vector;
@@ -221,6 +222,177 @@ static void Slerp()
 	,	s3d::UnitQuaternion<float>( 0, std::cos(theta/2), std::sin(theta/2), 0 ) 
 	);
 }
+
+
+static void Batch_Interpolation()
+{
+	size_t constexpr N = 200;
+
+	auto to_Vec_f
+	=	[](s3d::UnitQuaternion<float> const& q){  return Vector<float, 4>{q.w(), q.x(), q.y(), q.z()};  };
+
+	std::vector< s3d::UnitQuaternion<float> > q0s, q1s;
+	std::vector<float> ts;
+	s3d::PointSet<float, 4> Q0, Q1;
+
+	for(size_t idx = 0;  idx < N;  ++idx)
+	{
+		float const s = idx/float(N);
+
+		q0s.emplace_back( std::cos(7.f*s), s, 1.f - s, -.5f );
+		q1s.emplace_back( std::sin(3.f*s) - .5f, -s, .25f, 2.f*s - 1.f );
+		ts.push_back( std::fmod(s*13.f, 1.f) );
+
+		Q0.push_back( to_Vec_f(q0s.back()) ),  Q1.push_back( to_Vec_f(q1s.back()) );
+	}
+
+	{
+		auto const res = s3d::slerp_all(s3d::SEQ, Q0, Q1, ts);
+		auto const res_par = s3d::slerp_all(s3d::Parallel_Policy{4, 16}, Q0, Q1, ts);
+
+		for(size_t idx = 0;  idx < N;  ++idx)
+		{
+			::_identical
+			(	res(idx), res_par(idx)
+			,	to_Vec_f( s3d::UnitQuaternion<float>::Slerp(q0s[idx], q1s[idx], ts[idx]) )
+			);
+		}
+	}
+	{
+		std::vector<float> const halves(N, .5f);
+
+		auto const res = s3d::nlerp_all(s3d::SEQ, Q0, Q1, halves);
+
+		//	Nlerp and Slerp meet each other halfway .
+		for(size_t idx = 0;  idx < N;  ++idx)
+		{
+			::_identical( res(idx).norm(), 1.f );
+
+			::_identical
+			(	res(idx), to_Vec_f( s3d::UnitQuaternion<float>::Slerp(q0s[idx], q1s[idx], .5f) )
+			);
+		}
+	}
+	{
+		s3d::PointSet<float, 4> const keys{Q0(0), Q1(10), Q0(20), -Q1(30), Q0(40)};
+		std::vector<float> params;
+
+		for(float u = 0;  u <= 4.f;  u += .125f)
+			params.push_back(u);
+
+		auto const res = s3d::squad_all(s3d::SEQ, keys, params);
+
+		//	passes through every key , up to the sign .
+		for(size_t k = 0;  k < keys.size();  ++k)
+			::_identical( std::abs(res(8*k).dot( keys(k) )), 1.f );
+
+		//	two keys have no inner control point , so that Squad degenerates into Slerp .
+		s3d::PointSet<float, 4> const pair{Q0(0), Q1(10)};
+		std::vector<float> const ps{.3f, .7f};
+
+		auto const squad2 = s3d::squad_all(s3d::SEQ, pair, ps);
+		auto const slerp2
+		=	s3d::slerp_all
+			(	s3d::SEQ, s3d::PointSet<float, 4>{Q0(0), Q0(0)}, s3d::PointSet<float, 4>{Q1(10), Q1(10)}, ps
+			);
+
+		::_identical( squad2(0), slerp2(0) );
+		::_identical( squad2(1), slerp2(1) );
+
+		//	C1 continuity across a key : the one-sided differences agree up to O(h) .
+		std::vector<float> const around{1.999f, 2.f, 2.001f};
+
+		auto const c = s3d::squad_all(s3d::SEQ, keys, around);
+
+		SGM_H2U_ASSERT(  ( (c(1) - c(0))/.001f - (c(2) - c(1))/.001f ).norm() < .02f  );
+	}
+}
+
+
+static void Packed_Storage()
+{
+	static_assert(sizeof(s3d::Packed_UnitQuaternion<32>) == 4);
+	static_assert(sizeof(s3d::Packed_UnitQuaternion<48>) == 6);
+
+	::_identical( s3d::Packed_UnitQuaternion<32>{}.unit_qtn<float>(), s3d::UnitQuaternion<float>() );
+
+	auto angle_f
+	=	[](s3d::UnitQuaternion<double> const& q1, s3d::UnitQuaternion<double> const& q2)
+		{
+			double const c = std::abs( q1.w()*q2.w() + q1.v().dot(q2.v()) );
+
+			return 2*std::acos( std::min(c, 1.0) );
+		};
+
+	std::vector< s3d::UnitQuaternion<double> > uqs;
+	s3d::PointSet<double, 4> lanes;
+
+	for(size_t idx = 0;  idx < 1000;  ++idx)
+	{
+		double const s = idx/1000.0;
+
+		uqs.emplace_back( std::cos(11*s), std::sin(5*s), s - .5, -std::cos(3*s) );
+
+		lanes.push_back( Vector<double, 4>{uqs.back().w(), uqs.back().x(), uqs.back().y(), uqs.back().z()} );
+	}
+
+	double max_err32 = 0,  max_err48 = 0;
+
+	for(auto const& uq : uqs)
+	{
+		s3d::Packed_UnitQuaternion<32> const pq32 = uq;
+		s3d::Packed_UnitQuaternion<48> const pq48 = uq;
+
+		s3d::UnitQuaternion<double> const uq32 = pq32,  uq48 = pq48;
+
+		::_identical( uq32.qtn().sqr_norm(), 1.0 );
+
+		max_err32 = std::max( max_err32, angle_f(uq, uq32) );
+		max_err48 = std::max( max_err48, angle_f(uq, uq48) );
+	}
+
+	SGM_H2U_ASSERT(max_err32 <= s3d::Packed_UnitQuaternion<32>::MAX_ANGULAR_ERROR);
+	SGM_H2U_ASSERT(max_err48 <= s3d::Packed_UnitQuaternion<48>::MAX_ANGULAR_ERROR);
+	SGM_H2U_ASSERT(max_err48 < max_err32/16);
+
+	{
+		auto const pqs = s3d::encode_all<48>(s3d::Parallel_Policy{4, 16}, lanes);
+		auto const decoded = s3d::decode_all<double>(s3d::SEQ, pqs);
+
+		for(size_t idx = 0;  idx < uqs.size();  ++idx)
+		{
+			s3d::UnitQuaternion<double> const uq = pqs[idx];
+
+			SGM_H2U_ASSERT( pqs[idx].code() == s3d::Packed_UnitQuaternion<48>(uqs[idx]).code() );
+
+			::_identical( decoded(idx), Vector<double, 4>{uq.w(), uq.x(), uq.y(), uq.z()} );
+		}
+	}
+}
+//--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
+
+
+static void Literal_Quaternion()
+{
+	using s3d::LiteralQuaternion;
+
+	static LiteralQuaternion<double> constexpr
+		q1 = LiteralQuaternion<double>::Euler_angles(.1, -.4, 1.3),
+		q2 = LiteralQuaternion<double>::Spin( s3d::LiteralVec<double, 3>{0, 0, 2}, Pi/2 ),
+		q3(1, -2, 3, .5);
+
+	static_assert(q2.x() == 0 && q2.y() == 0 && q2.ortho_mat()(2, 2) == 1);
+	static_assert( (q3 + q3 - q3).w() == q3.w() && (2*q3).x() == -4 && q3.conjugate().z() == -.5 );
+
+	s3d::Quaternion<double> const p1 = q1,  p2 = q2,  p3 = q3;
+
+	::_identical(p1.norm(), 1.0),  ::_identical(p2.norm(), 1.0);
+	::_identical( p2, s3d::Quaternion<double>( std::cos(Pi/4.0), 0, 0, std::sin(Pi/4.0) ) );
+	::_identical( s3d::Quaternion<double>(q1*q3), p1*p3 );
+	::_identical( s3d::Quaternion<double>(q3.inv()), p3.inv() );
+	::_identical( s3d::Quaternion<double>(q3.normalized()), p3.normalized() );
+	::_identical( s3d::UnitQuaternion<double>(q3), p3.normalized() );
+}
 //--------//--------//--------//--------//-------#//--------//--------//--------//--------//-------#
 
 
@@ -232,4 +404,7 @@ SGM_HOW2USE_TESTS(s3d::spec::Test_, Quaternion, /**/)
 ,	::Unary_Operation
 ,	::Algebra
 ,	::Slerp
+,	::Batch_Interpolation
+,	::Packed_Storage
+,	::Literal_Quaternion
 };
\ No newline at end of file
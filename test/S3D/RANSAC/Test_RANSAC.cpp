@@ -0,0 +1,137 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "Test_RANSAC.hpp"
+#include <random>
+
+
+using s3d::Vector;
+using s3d::UnitVec;
+using s3d::PointSet;
+using s3d::SAC_Mode;
+
+
+static auto _random_vec(std::mt19937& engine, float const range)-> Vector<float, 3>
+{
+	std::uniform_real_distribution<float> dist(-range, range);
+
+	return {dist(engine), dist(engine), dist(engine)};
+}
+
+
+//	nof_inliers points within noise of the primitive , followed by nof_outliers points anywhere .
+template<class PRIM>
+static auto _samples
+(	PRIM const& prim, size_t const nof_inliers, size_t const nof_outliers, float const noise
+,	std::mt19937& engine
+)->	PointSet<float, 3>
+{
+	PointSet<float, 3> res;
+
+	for(size_t i = 0;  i < nof_inliers;  ++i)
+	{
+		Vector<float, 3> p = prim.position() + ::_random_vec(engine, 5.f);
+
+		p = s3d::Projection(p, prim);
+
+		res.push_back( Vector<float, 3>(p + ::_random_vec(engine, noise)) );
+	}
+
+	for(size_t i = 0;  i < nof_outliers;  ++i)
+		res.push_back( ::_random_vec(engine, 6.f) );
+
+	return res;
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Plane_Fitting()
+{
+	std::mt19937 engine(2026);
+
+	s3d::Plane<float, 3> const answer( Vector<float, 3>{1.f, -.5f, .3f}, UnitVec<float, 3>{1, 2, -2} );
+	auto const points = ::_samples(answer, 600, 400, .01f, engine);
+
+	s3d::Sample_Consensus< s3d::Plane<float, 3> > sac( .05f, sgm::Flags(s3d::flag::Random_Seed(7)) );
+
+	auto const plane = sac.fit(s3d::SEQ, points);
+
+	SGM_H2U_ASSERT
+	(	plane.has_value() && std::abs( plane.v().normal().dot(answer.normal()) ) > .9999f
+	&&	std::abs( plane.v().signed_dist_to(answer.position()) ) < .005f
+	);
+
+	//	every sampled inlier and only a few of the outliers lying near the plane by chance .
+	SGM_H2U_ASSERT( sac.inliers().size() >= 600 && sac.inliers().size() < 620 );
+
+	//	far fewer hypotheses than the cap , as the inlier ratio is known to be high .
+	SGM_H2U_ASSERT( sac.nof_iterations() < 100 );
+
+	{
+		auto const plane2 = sac.fit(s3d::Parallel_Policy{4, 1}, points);
+
+		SGM_H2U_ASSERT
+		(	( plane2.v().position() - plane.v().position() ).norm() == 0
+		&&	( plane2.v().normal().vec() - plane.v().normal().vec() ).norm() == 0
+		);
+	}
+}
+
+
+static void Line_Fitting()
+{
+	std::mt19937 engine(17);
+
+	s3d::Line<float, 3> const answer( Vector<float, 3>{-1.f, 2.f, .5f}, UnitVec<float, 3>{3, -1, 1} );
+	auto const points = ::_samples(answer, 300, 700, .01f, engine);
+
+	s3d::Sample_Consensus< s3d::Line<float, 3>, SAC_Mode::RANSAC > sac
+	(	.05f, sgm::Flags( s3d::flag::Confidence<float>(.999f), s3d::flag::Iteration_Cap(5000) )
+	);
+
+	auto const line = sac.fit(s3d::PAR, points);
+
+	SGM_H2U_ASSERT
+	(	line.has_value() && std::abs( line.v().tangent().dot(answer.tangent()) ) > .9999f
+	&&	s3d::Distance(answer.position(), line.v()) < .005f
+	);
+
+	SGM_H2U_ASSERT( sac.inliers().size() >= 300 && sac.inliers().size() < 310 );
+}
+
+
+static void Degenerate_Input()
+{
+	s3d::Sample_Consensus< s3d::Plane<float, 3> > sac(.1f);
+
+	SGM_H2U_ASSERT( !sac.fit(s3d::SEQ, PointSet<float, 3>{}).has_value() && sac.inliers().empty() );
+
+	{
+		PointSet<float, 3> collinear;
+
+		for(size_t i = 0;  i < 50;  ++i)
+			collinear.push_back( Vector<float, 3>{float(i), 2.f*i, 0.f} );
+
+		//	no sample spans a plane .
+		SGM_H2U_ASSERT
+		(	!sac.fit(s3d::SEQ, collinear).has_value() && sac.nof_iterations() == 1000
+		);
+
+		s3d::Sample_Consensus< s3d::Line<float, 3> > line_sac(.1f);
+
+		auto const line = line_sac.fit(s3d::SEQ, collinear);
+
+		SGM_H2U_ASSERT( line.has_value() && line_sac.inliers().size() == 50 );
+	}
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, RANSAC, /**/)
+{	::Plane_Fitting
+,	::Line_Fitting
+,	::Degenerate_Input
+};
@@ -0,0 +1,217 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../Affine/Test_Affine.hpp"
+#include "Test_Registration.hpp"
+
+
+using s3d::Vector;
+using s3d::UnitVec;
+using s3d::PointSet;
+using s3d::ICP_Mode;
+using s3d::spec::Pi;
+
+
+template<class...TYPES>
+static void _identical(TYPES...types)
+{
+	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_Affine_Tag>::calc(types...) );
+}
+
+
+//	Samples of the surface z = sin(2x)cos(3y)/3 over [-1, 1]^2 , which has no symmetry to slide along .
+static void _surface(size_t const n, PointSet<float, 3>& points, PointSet<float, 3>& normals)
+{
+	points.clear(),  normals.clear();
+
+	for(size_t i = 0;  i < n;  ++i)
+		for(size_t j = 0;  j < n;  ++j)
+		{
+			float const
+				x = -1.f + 2.f*i/(n - 1),  y = -1.f + 2.f*j/(n - 1),
+				z = std::sin(2*x)*std::cos(3*y)/3,
+				zx = 2*std::cos(2*x)*std::cos(3*y)/3,  zy = -3*std::sin(2*x)*std::sin(3*y)/3;
+
+			points.push_back( Vector<float, 3>{x, y, z} );
+			normals.push_back( UnitVec<float, 3>(Vector<float, 3>{-zx, -zy, 1.f}).vec() );
+		}
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Streaming_Alignment()
+{
+	PointSet<float, 3> target, normals;
+
+	::_surface(20, target, normals);
+
+	auto const answer = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{3, 1, -1}, Pi/7.f).translate(.3f, .2f, -.4f);
+	auto const source = target >> answer.inv();
+
+	s3d::Alignment_Accumulator<float> whole,  parts[3];
+
+	for(size_t i = 0;  i < source.size();  ++i)
+		whole.push( source(i), target(i) ),
+		parts[i % 3].push( source(i), target(i) );
+
+	::_identical( whole.rigid_transform().v(), answer );
+
+	{
+		//	merged partial sums are the sums over all pairs .
+		s3d::Alignment_Accumulator<float> merged;
+
+		for(auto const& part : parts)
+			merged.merge(part);
+
+		SGM_H2U_ASSERT( merged.size() == source.size() );
+
+		::_identical( merged.rigid_transform().v(), answer );
+		::_identical( merged.source_centroid(), whole.source_centroid() );
+		::_identical( merged.cross_covariance(), whole.cross_covariance() );
+	}
+	{
+		//	Umeyama finds the scale too .
+		auto const scaled = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, 1, 0}, -Pi/5.f).scale(2.5f).translate(1.f, -2.f, .5f);
+		auto const scaled_target = source >> scaled;
+
+		s3d::Alignment_Accumulator<float> acc;
+
+		for(size_t i = 0;  i < source.size();  ++i)
+			acc.push( source(i), scaled_target(i) );
+
+		auto const sbtr = acc.scalable_transform();
+
+		::_identical( sbtr.v(), scaled );
+		::_identical( sbtr.v().scalar(), 2.5f );
+	}
+	{
+		//	too few pairs to align .
+		s3d::Alignment_Accumulator<float> acc;
+
+		acc.push( source(0), target(0) ).push( source(1), target(1) );
+
+		SGM_H2U_ASSERT( !acc.rigid_transform().has_value() && !acc.scalable_transform().has_value() );
+
+		acc.clear();
+
+		SGM_H2U_ASSERT( acc.size() == 0 );
+	}
+}
+
+
+static void Point_to_Point()
+{
+	PointSet<float, 3> target, normals;
+
+	::_surface(40, target, normals);
+
+	auto const answer = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{1, -2, 3}, Pi/18.f).translate(.1f, -.05f, .08f);
+	auto const source = target >> answer.inv();
+
+	s3d::Iterative_Closest_Point<float> icp
+	(	s3d::SEQ, target, sgm::Flags( s3d::flag::Tolerance<float>(1e-6f), s3d::flag::Iteration_Cap(100) )
+	);
+
+	auto const rbtr = icp.align(s3d::Parallel_Policy{4, 64}, source);
+
+	::_identical(rbtr, answer);
+
+	SGM_H2U_ASSERT( icp.converged() && !icp.stats().empty() && icp.stats().size() <= 100 );
+	SGM_H2U_ASSERT( icp.stats().front().rms_residual > icp.stats().back().rms_residual );
+	SGM_H2U_ASSERT( icp.stats().back().nof_correspondences == source.size() );
+	SGM_H2U_ASSERT( icp.stats().back().rms_residual < 1e-3f );
+	SGM_H2U_ASSERT( icp.stats().back().correspondence_time.count() >= 0 );
+
+	//	partial sums are merged in a fixed order , so that any policy gives the same bits .
+	for(auto const& policy : {s3d::Parallel_Policy{4, 64}, s3d::Parallel_Policy{3, 1}})
+	{
+		auto const rbtr_par = icp.align(policy, source);
+
+		for(size_t d = 0;  d < 3;  ++d)
+			SGM_H2U_ASSERT( rbtr_par.vec()(d) == rbtr.vec()(d) );
+	}
+
+	SGM_H2U_ASSERT( icp.align(s3d::SEQ, source).vec()(0) == rbtr.vec()(0) );
+
+	//	the same registration again from the answer converges at once .
+	auto const rbtr2 = icp.align(s3d::SEQ, source, answer);
+
+	::_identical(rbtr2, answer);
+
+	SGM_H2U_ASSERT( icp.stats().size() <= 3 );
+}
+
+
+static void Point_to_Plane()
+{
+	PointSet<float, 3> target, normals;
+
+	::_surface(40, target, normals);
+
+	auto const answer = s3d::Afn<float, 3>.rotate(UnitVec<float, 3>{-2, 1, 1}, Pi/15.f).translate(-.1f, .1f, .05f);
+	auto const source = target >> answer.inv();
+
+	s3d::Iterative_Closest_Point<float, ICP_Mode::POINT_TO_PLANE> icp
+	(	s3d::PAR, target, normals, sgm::Flags( s3d::flag::Tolerance<float>(1e-6f) )
+	);
+
+	auto const rbtr = icp.align(s3d::Parallel_Policy{4, 64}, source);
+
+	::_identical(rbtr, answer);
+
+	SGM_H2U_ASSERT( icp.converged() && icp.stats().back().rms_residual < 1e-3f );
+}
+
+
+static void Rejection()
+{
+	PointSet<float, 3> target, normals;
+
+	::_surface(30, target, normals);
+
+	auto const answer = s3d::Afn<float, 3>.translate(.02f, -.01f, .03f);
+
+	PointSet<float, 3> source = target >> answer.inv();
+
+	//	outliers far from the target are left out of alignment .
+	for(size_t i = 0;  i < 20;  ++i)
+		source.push_back( Vector<float, 3>{5.f + i, -3.f, 7.f} );
+
+	s3d::Iterative_Closest_Point<float> icp
+	(	s3d::SEQ, target
+	,	sgm::Flags( s3d::flag::Tolerance<float>(1e-6f), s3d::flag::Rejection_Distance<float>(.5f) )
+	);
+
+	::_identical( icp.align(s3d::SEQ, source), answer );
+
+	SGM_H2U_ASSERT( icp.stats().back().nof_correspondences == target.size() );
+}
+
+
+static void Empty_Target()
+{
+	PointSet<float, 3> target, normals, source;
+
+	::_surface(10, source, normals);
+
+	auto const initial = s3d::Afn<float, 3>.translate(.1f, .2f, .3f);
+
+	s3d::Iterative_Closest_Point<float> icp(s3d::SEQ, target);
+
+	::_identical( icp.align(s3d::PAR, source, initial), initial );
+
+	SGM_H2U_ASSERT( icp.stats().empty() && !icp.converged() );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, Registration, /**/)
+{	::Streaming_Alignment
+,	::Point_to_Point
+,	::Point_to_Plane
+,	::Rejection
+,	::Empty_Target
+};
@@ -0,0 +1,89 @@
+/*  SPDX-FileCopyrightText: (c) 2026 Jin-Eon Park <greengb@naver.com> <sigma@gm.gist.ac.kr>
+*   SPDX-License-Identifier: MIT License
+*/
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+#include "../Hamilton/Test_Hamilton.hpp"
+#include "Test_Sparse.hpp"
+#include <vector>
+
+
+using s3d::Matrix;
+using s3d::Vector;
+using s3d::SparseMat;
+
+
+template<class...TYPES>
+static void _identical(TYPES...types)
+{
+	SGM_H2U_ASSERT( s3d::spec::_Equivalent<s3d::spec::_Equiv_Hamilton_Tag>::calc(types...) );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+static void Construction()
+{
+	using Entry = SparseMat<float>::Entry;
+
+	std::vector<Entry> const entries
+	{	Entry{0, 0, 1.f}
+	,	Entry{1, 2, -2.f}
+	,	Entry{3, 1, .5f}
+	,	Entry{1, 2, -1.f}
+	};
+
+	SparseMat<float> const A(4, 3, entries);
+
+	::_identical(A.rows(), size_t(4));
+	::_identical(A.cols(), size_t(3));
+	::_identical(A.nof_nonzeros(), size_t(3));
+
+	::_identical( A.coeff(0, 0), 1.f );
+	::_identical( A.coeff(1, 2), -3.f );
+	::_identical( A.coeff(3, 1), .5f );
+	::_identical( A.coeff(2, 2), 0.f );
+
+	SparseMat<float> const B(2, 2, {Entry{0, 1, 2.f}, Entry{1, 0, 3.f}});
+
+	::_identical( B.dense(), Matrix<float, 2, 2>{0.f, 2.f, 3.f, 0.f} );
+
+	SparseMat<float> const Z(5, 7);
+
+	::_identical(Z.rows(), size_t(5));
+	::_identical(Z.cols(), size_t(7));
+	::_identical(Z.nof_nonzeros(), size_t(0));
+}
+
+
+static void Dense_Interoperation()
+{
+	Matrix<float, 3, 4> const M
+	{	1.f, 0.f, 0.f, .001f
+	,	0.f, 0.f, 2.f, 0.f
+	,	0.f, -3.f, 0.f, 4.f
+	};
+
+	SparseMat<float> const A(M), A_cut(M, .01f);
+
+	::_identical(A.nof_nonzeros(), size_t(5));
+	::_identical(A_cut.nof_nonzeros(), size_t(4));
+	::_identical(A.dense(), M);
+
+	Vector<float, 4> const v{1.f, 2.f, 3.f, 4.f};
+	Matrix<float, 4, 2> const W{1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f};
+
+	::_identical(A*v, M*v);
+	::_identical(A*W, M*W);
+
+	::_identical(A.transpose().dense(), M.transpose());
+	::_identical( (A.transpose()*A).dense(), M.transpose()*M );
+	::_identical( (2.f*A).dense(), 2.f*M );
+}
+//========//========//========//========//=======#//========//========//========//========//=======#
+
+
+SGM_HOW2USE_TESTS(s3d::spec::Test_, Sparse, /**/)
+{	::Construction
+,	::Dense_Interoperation
+};
@@ -70,6 +70,14 @@ bool wt::Tests(wchar_t const* const module_title) noexcept
 #include "S3D/Euclid/Test_Euclid.hpp"
 #include "S3D/Quaternion/Test_Quaternion.hpp"
 #include "S3D/Affine/Test_Affine.hpp"
+#include "S3D/PointSet/Test_PointSet.hpp"
+#include "S3D/Parallel/Test_Parallel.hpp"
+#include "S3D/Sparse/Test_Sparse.hpp"
+#include "S3D/DualQuaternion/Test_DualQuaternion.hpp"
+#include "S3D/BVH/Test_BVH.hpp"
+#include "S3D/KdTree/Test_KdTree.hpp"
+#include "S3D/Registration/Test_Registration.hpp"
+#include "S3D/RANSAC/Test_RANSAC.hpp"
 
 
 void test() noexcept(false)
@@ -79,6 +87,14 @@ void test() noexcept(false)
     s3d::spec::Test_Euclid::test();
     s3d::spec::Test_Quaternion::test();
     s3d::spec::Test_Affine::test();
+    s3d::spec::Test_PointSet::test();
+    s3d::spec::Test_Parallel::test();
+    s3d::spec::Test_Sparse::test();
+    s3d::spec::Test_DualQuaternion::test();
+    s3d::spec::Test_BVH::test();
+    s3d::spec::Test_KdTree::test();
+    s3d::spec::Test_Registration::test();
+    s3d::spec::Test_RANSAC::test();
 }
 
 